@@ -21,6 +21,7 @@ If not, see <https://www.gnu.org/licenses/>. */
 #include "DeathEffect.h"
 #include "HealthComponent.h"
 #include "Flags.h"
+#include "InlineComponent.h"
 
 #include "../GameState.h"
 #include "../Sprite.h"
@@ -32,7 +33,7 @@ If not, see <https://www.gnu.org/licenses/>. */
 #include <SFML/Window.hpp>
 #include <SFML/System.hpp>
 
-#include <vector>
+#include <array>
 #include <memory>
 #include <algorithm>
 
@@ -41,7 +42,24 @@ namespace Airplane {
     public:
         // use Airplane::Builder instead
         Airplane(GameState& gameState) noexcept : 
-            Sprite{gameState}, m_shootComponent{*this, gameState} {}
+            Sprite{gameState}, m_shootComponent{*this, gameState}, m_deathEffectCount{0} {}
+
+        // components of the copy reference the copy
+        // virtual base Entity must be copied explicitly or the copy loses its id
+        Airplane(const Airplane& other) : 
+                Entity{other}, Sprite{other}, CollidableBase<Airplane>{other}, m_shootComponent{other.m_shootComponent, *this}, 
+                m_deathEffectCount{other.m_deathEffectCount}, 
+                m_healthComponent{other.m_healthComponent}, m_flags{other.m_flags} {
+            m_shootControlComponent.copyFrom(other.m_shootControlComponent, *this);
+            m_moveComponent        .copyFrom(other.m_moveComponent        , *this);
+            m_bombComponent        .copyFrom(other.m_bombComponent        , *this);
+            for (int i = 0; i < m_deathEffectCount; ++ i)
+                m_deathEffects[i].copyFrom(other.m_deathEffects[i], *this);
+        }
+
+        std::unique_ptr<Entity> clone() const override {
+            return std::make_unique<Airplane>(*this);
+        }
 
         void handleEvent(sf::Event event) noexcept override {
             m_shootControlComponent->handleEvent(event);
@@ -84,8 +102,6 @@ namespace Airplane {
         }
 
         void update(sf::Time elapsedTime) noexcept override {
-            m_healthComponent.update(elapsedTime);
-            m_shootComponent.update(elapsedTime);
             m_moveComponent ->update(elapsedTime);
             m_bombComponent ->update(elapsedTime);
 
@@ -96,6 +112,21 @@ namespace Airplane {
             updateTexture();
         }
 
+        void handleTimer(int type) noexcept override {
+            switch (type) {
+            case SHOOT_TIMER:
+                m_shootComponent.handleTimer();
+                break;
+            case DAMAGE_COOLDOWN_TIMER:
+                m_healthComponent.endDamageCooldown();
+                break;
+            }
+        }
+
+        void coast(sf::Time elapsedTime) noexcept override {
+            move(elapsedTime.asSeconds() * m_moveComponent->getMinSpeed());
+        }
+
         bool shouldBeDeleted() const noexcept override {
             return m_healthComponent.isDead() || !m_gameState.inActiveArea(getPosition().x);
         }
@@ -116,13 +147,26 @@ namespace Airplane {
             return m_bombComponent->hasBomb();
         }
     private:
+        // buffer sizes for components stored inside the airplane
+        static const constexpr size_t SHOOT_CONTROL_COMPONENT_CAPACITY = 64;
+        static const constexpr size_t MOVE_COMPONENT_CAPACITY          = 64;
+        static const constexpr size_t BOMB_COMPONENT_CAPACITY          = 32;
+        static const constexpr size_t DEATH_EFFECT_CAPACITY            = 32;
+
+        static const constexpr int MAX_DEATH_EFFECTS = 4;
+
+        // types of timers scheduled by airplanes and their components
+        static const constexpr int SHOOT_TIMER           = 0;
+        static const constexpr int DAMAGE_COOLDOWN_TIMER = 1;
+
         ShootComponent m_shootComponent;
 
-        std::unique_ptr<ShootControlComponent> m_shootControlComponent;
-        std::unique_ptr<MoveComponent> m_moveComponent;
-        std::unique_ptr<BombComponent> m_bombComponent;
+        InlineComponent<ShootControlComponent, SHOOT_CONTROL_COMPONENT_CAPACITY> m_shootControlComponent;
+        InlineComponent<MoveComponent, MOVE_COMPONENT_CAPACITY> m_moveComponent;
+        InlineComponent<BombComponent, BOMB_COMPONENT_CAPACITY> m_bombComponent;
 
-        std::vector<std::unique_ptr<DeathEffect>> m_deathEffects;
+        std::array<InlineComponent<DeathEffect, DEATH_EFFECT_CAPACITY>, MAX_DEATH_EFFECTS> m_deathEffects;
+        int m_deathEffectCount;
 
         HealthComponent m_healthComponent;
 
@@ -140,9 +184,13 @@ namespace Airplane {
         }
 
         void damage() noexcept {
+            if (!m_healthComponent.canBeDamaged()) return;
+
+            m_gameState.getTimers().schedule(sf::seconds(HealthComponent::DAMAGE_COOLDOWN), 
+                                             {getId(), DAMAGE_COOLDOWN_TIMER});
             if (m_healthComponent.damage())
-                for (auto& deathEffect : m_deathEffects) 
-                    deathEffect->handleDeath();
+                for (int i = 0; i < m_deathEffectCount; ++ i) 
+                    m_deathEffects[i]->handleDeath();
         }
 
         void drawAir(sf::RenderTarget& target, sf::RenderStates states) const noexcept override {
@@ -151,6 +199,7 @@ namespace Airplane {
         }
 
         friend class Builder;
+        friend class ShootComponent;
     };
 }
 
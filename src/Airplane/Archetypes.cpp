@@ -0,0 +1,141 @@
+/* This file is part of Jutchs Shmup.
+
+Jutchs Shmup is free software: you can redistribute it and/or modify it 
+under the terms of the GNU General Public License as published by the Free Software Foundation, 
+either version 3 of the License, or (at your option) any later version.
+
+Jutchs Shmup is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with Jutchs Shmup. 
+If not, see <https://www.gnu.org/licenses/>. */
+
+#include "Archetypes.h"
+
+#include <array>
+
+namespace Airplane {
+    namespace {
+        std::array<ShootComponent::PatternElement, 1> basicPattern {
+            ShootComponent::PatternElement{{0.f, 0.f}, sf::seconds(0.25f)}
+        };
+
+        std::array<ShootComponent::PatternElement, 3> triplePattern {
+            ShootComponent::PatternElement{{0.f,   0.f}, sf::seconds(0.0f)},
+            ShootComponent::PatternElement{{0.f,  32.f}, sf::seconds(0.0f)},
+            ShootComponent::PatternElement{{0.f, -32.f}, sf::seconds(0.5f)}
+        };
+
+        std::array<ShootComponent::PatternElement, 3> volleyPattern {
+            ShootComponent::PatternElement{{0.f, 0.f}, sf::seconds(0.1f)},
+            ShootComponent::PatternElement{{0.f, 0.f}, sf::seconds(0.1f)},
+            ShootComponent::PatternElement{{0.f, 0.f}, sf::seconds(0.5f)}
+        };
+    }
+
+    ShootComponent::Pattern getBasicShootPattern() noexcept {
+        return basicPattern;
+    }
+
+    ArchetypeTable::ArchetypeTable() {
+        using enum Flags;
+
+        struct Health {
+            int maxHealth;
+            Flags flags;
+        };
+
+        struct Weapon {
+            ShootComponent::Pattern pattern;
+            Flags flags;
+            bool advanced;
+        };
+
+        struct Speed {
+            sf::Vector2f speed;
+            Flags flags;
+        };
+
+        const std::array<ChanceTable::BasicEntry<Health>, 2> healthOptions{{
+            {{3, HEAVY}, 0.1},
+            {{1, LIGHT}, 0.9},
+        }};
+
+        const std::array<ChanceTable::BasicEntry<Weapon>, 3> weaponOptions{{
+            {{triplePattern, HAS_WEAPON, true }, 0.1},
+            {{volleyPattern, NO_WEAPON , true }, 0.1},
+            {{basicPattern , NO_WEAPON , false}, 0.8},
+        }};
+
+        const std::array<ChanceTable::BasicEntry<Archetype::ShootControl>, 3> shootControlOptions{{
+            {Archetype::ShootControl::TARGET_PLAYER , 0.1},
+            {Archetype::ShootControl::NEVER         , 0.1},
+            {Archetype::ShootControl::CAN_HIT_PLAYER, 0.8},
+        }};
+
+        const std::array<ChanceTable::BasicEntry<Speed>, 2> speedOptions{{
+            {{{500.f, 250.f}, FAST}, 0.1},
+            {{{250.f, 250.f}, SLOW}, 0.9},
+        }};
+
+        const std::array<ChanceTable::BasicEntry<bool>, 2> bombOptions{{
+            {true , 0.1},
+            {false, 0.9},
+        }};
+
+        // airplanes with bomb fly to targets with this chance and use moveOptions otherwise
+        const double targetLandChance = 0.9;
+
+        const std::array<ChanceTable::BasicEntry<Archetype::Move>, 3> moveOptions{{
+            {Archetype::Move::PERIODICAL   , 0.1},
+            {Archetype::Move::TARGET_PLAYER, 0.1},
+            {Archetype::Move::BASIC        , 0.8},
+        }};
+
+        for (auto [health, healthChance] : healthOptions)
+        for (auto [weapon, weaponChance] : weaponOptions)
+        for (auto [shootControl, shootControlChance] : shootControlOptions)
+        for (auto [speed, speedChance] : speedOptions)
+        for (auto [hasBomb, bombChance] : bombOptions) {
+            Archetype archetype{health.maxHealth, weapon.pattern, shootControl, speed.speed, hasBomb, 
+                                Archetype::Move::BASIC, ENEMY_SIDE | NO_PICKUPS, 10};
+
+            archetype.flags |= health.flags;
+            if (test(health.flags, HEAVY)) archetype.score *= 2;
+
+            archetype.flags |= weapon.flags;
+            bool advancedWeapon = weapon.advanced;
+            if (shootControl == Archetype::ShootControl::NEVER) {
+                archetype.flags &= ~HAS_WEAPON;
+                advancedWeapon = false;
+                archetype.score /= 2;
+            }
+            if (advancedWeapon) archetype.score *= 2;
+
+            archetype.flags |= speed.flags;
+            if (test(speed.flags, FAST)) archetype.score *= 2;
+
+            if (hasBomb) archetype.score *= 2;
+
+            double chance = healthChance * weaponChance * shootControlChance * speedChance * bombChance;
+            double otherMoveChance = 1.0;
+            if (hasBomb) {
+                archetype.move = Archetype::Move::TARGET_LAND;
+                m_archetypes.push_back({archetype, chance * targetLandChance});
+                otherMoveChance -= targetLandChance;
+            }
+
+            for (auto [move, moveChance] : moveOptions) {
+                archetype.move = move;
+                m_archetypes.push_back({archetype, chance * otherMoveChance * moveChance});
+            }
+        }
+
+        double sumChance = 0.0;
+        for (const auto& entry : m_archetypes) {
+            sumChance += chance(entry);
+            m_cumulativeChances.push_back(sumChance);
+        }
+    }
+}
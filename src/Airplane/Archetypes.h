@@ -0,0 +1,82 @@
+/* This file is part of Jutchs Shmup.
+
+Jutchs Shmup is free software: you can redistribute it and/or modify it 
+under the terms of the GNU General Public License as published by the Free Software Foundation, 
+either version 3 of the License, or (at your option) any later version.
+
+Jutchs Shmup is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with Jutchs Shmup. 
+If not, see <https://www.gnu.org/licenses/>. */
+
+#ifndef AIRPLANE_ARCHETYPES_H_
+#define AIRPLANE_ARCHETYPES_H_
+
+#include "ShootComponent.h"
+#include "Flags.h"
+
+#include "../ChanceTableEntry.h"
+
+#include <SFML/System.hpp>
+
+#include <vector>
+#include <random>
+#include <algorithm>
+
+namespace Airplane {
+    // everything needed to build an enemy except its position
+    struct Archetype {
+        enum class ShootControl {
+            TARGET_PLAYER, // shoot when player is in affected area and can be hit
+            CAN_HIT_PLAYER,
+            NEVER,
+        };
+
+        enum class Move {
+            BASIC,
+            PERIODICAL,
+            TARGET_PLAYER,
+            TARGET_LAND, // fly to enemy targets on land to bomb them
+        };
+
+        int maxHealth;
+        ShootComponent::Pattern shootPattern;
+        ShootControl shootControl;
+        sf::Vector2f speed;
+        bool hasBomb;
+        Move move;
+
+        Flags flags;
+        int score;
+    };
+
+    // pattern of a single bullet, also used by player
+    ShootComponent::Pattern getBasicShootPattern() noexcept;
+
+    // every enemy variant with the chance to spawn it
+    // precomputed so spawn needs only one random number
+    class ArchetypeTable {
+    public:
+        ArchetypeTable();
+
+        template <std::uniform_random_bit_generator Engine>
+        const Archetype& getRandom(Engine& engine) const {
+            double seed = std::uniform_real_distribution{0.0, m_cumulativeChances.back()}(engine);
+            auto chosen = std::ranges::upper_bound(m_cumulativeChances, seed);
+            if (chosen == m_cumulativeChances.end()) 
+                -- chosen;
+            return value(m_archetypes[chosen - m_cumulativeChances.begin()]);
+        }
+
+        const std::vector<ChanceTable::BasicEntry<Archetype>>& getArchetypes() const noexcept {
+            return m_archetypes;
+        }
+    private:
+        std::vector<ChanceTable::BasicEntry<Archetype>> m_archetypes;
+        std::vector<double> m_cumulativeChances;
+    };
+}
+
+#endif
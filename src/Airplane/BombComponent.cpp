@@ -21,6 +21,9 @@ namespace Airplane {
     BombComponent::BombComponent(Airplane& owner, GameState& gameState) noexcept :
         m_owner{owner}, m_gameState{gameState}, m_hasBomb{false} {}
 
+    BombComponent::BombComponent(const BombComponent& other, Airplane& owner) noexcept :
+        m_owner{owner}, m_gameState{other.m_gameState}, m_hasBomb{other.m_hasBomb} {}
+
     void BombComponent::tryBomb() {
         if (m_hasBomb)
             m_gameState.getEntities().addEntity<Bomb>(m_owner.isOnPlayerSide(), m_owner.getPosition());
@@ -25,6 +25,7 @@ namespace Airplane {
     class BombComponent {
     public:
         BombComponent(Airplane& owner, GameState& gameState) noexcept;
+        BombComponent(const BombComponent& other, Airplane& owner) noexcept;
         virtual ~BombComponent() = default;
 
         virtual void handleEvent(sf::Event event) {}
@@ -21,6 +21,8 @@ If not, see <https://www.gnu.org/licenses/>. */
 #include "functional.h"
 
 #include <concepts>
+#include <stdexcept>
+
 namespace Airplane {
     class Builder {
     public:
@@ -81,64 +83,61 @@ namespace Airplane {
 
         template <typename Factory, typename... Args>
         Builder& shootControlComponent(Factory&& factory, Args&&... args) {
-            m_build->m_shootControlComponent = newComponentBy<ShootControlComponent>(
-                std::forward<Factory>(factory), std::forward<Args>(args)...);
+            emplaceComponentBy(m_build->m_shootControlComponent, 
+                               std::forward<Factory>(factory), std::forward<Args>(args)...);
             return *this;
         }
 
         template<std::derived_from<ShootControlComponent> Component, typename... Args>
         Builder& shootControlComponent(Args&&... args) {
-            return shootControlComponent(makeUniqueFunctor<Component>, std::forward<Args>(args)...);
+            return shootControlComponent(constructFunctor<Component>, std::forward<Args>(args)...);
         }
 
         template <typename Component>
             requires std::derived_from<std::remove_cvref_t<Component>, ShootControlComponent>
         Builder& shootControlComponent(Component&& component) {
             using ComponentVal = std::remove_cvref_t<Component>;
-            m_build->m_shootControlComponent 
-                = std::make_unique<ComponentVal>(std::forward<Component>(component));
+            m_build->m_shootControlComponent.template emplace<ComponentVal>(std::forward<Component>(component));
             return *this;
         }
 
         template <typename Factory, typename... Args>
         Builder& moveComponent(Factory&& factory, Args&&... args) {
-            m_build->m_moveComponent = newComponentBy<MoveComponent>(std::forward<Factory>(factory), 
-                                                                     std::forward<Args>(args)...);
+            emplaceComponentBy(m_build->m_moveComponent, 
+                               std::forward<Factory>(factory), std::forward<Args>(args)...);
             return *this;
         }
 
         template<std::derived_from<MoveComponent> Component, typename... Args>
         Builder& moveComponent(Args&&... args) {
-            return moveComponent(makeUniqueFunctor<Component>, std::forward<Args>(args)...);
+            return moveComponent(constructFunctor<Component>, std::forward<Args>(args)...);
         }
 
         template <typename Component>
             requires std::derived_from<std::remove_cvref_t<Component>, MoveComponent>
         Builder& moveComponent(Component&& component) {
             using ComponentVal = std::remove_cvref_t<Component>;
-            m_build->m_moveComponent
-                = std::make_unique<ComponentVal>(std::forward<Component>(component));
+            m_build->m_moveComponent.template emplace<ComponentVal>(std::forward<Component>(component));
             return *this;
         }
 
         template <typename Factory, typename... Args>
         Builder& bombComponent(Factory&& factory, Args&&... args) {
-            m_build->m_bombComponent = newComponentBy<BombComponent>(std::forward<Factory>(factory), 
-                                                                     std::forward<Args>(args)...);
+            emplaceComponentBy(m_build->m_bombComponent, 
+                               std::forward<Factory>(factory), std::forward<Args>(args)...);
             return *this;
         }
 
         template<std::derived_from<BombComponent> Component, typename... Args>
         Builder& bombComponent(Args&&... args) {
-            return bombComponent(makeUniqueFunctor<Component>, std::forward<Args>(args)...);
+            return bombComponent(constructFunctor<Component>, std::forward<Args>(args)...);
         }
 
         template <typename Component>
             requires std::derived_from<std::remove_cvref_t<Component>, BombComponent>
         Builder& bombComponent(Component&& component) {
             using ComponentVal = std::remove_cvref_t<Component>;
-            m_build->m_bombComponent
-                = std::make_unique<ComponentVal>(std::forward<Component>(component));
+            m_build->m_bombComponent.template emplace<ComponentVal>(std::forward<Component>(component));
             return *this;
         }
 
@@ -149,22 +148,21 @@ namespace Airplane {
 
         template <typename Factory, typename... Args>
         Builder& addDeathEffect(Factory&& factory, Args&&... args) {
-            m_build->m_deathEffects.push_back(newComponentBy<DeathEffect>(std::forward<Factory>(factory), 
-                                                                          std::forward<Args>(args)...));
+            emplaceComponentBy(nextDeathEffect(), 
+                               std::forward<Factory>(factory), std::forward<Args>(args)...);
             return *this;
         }
 
         template<std::derived_from<DeathEffect> Effect, typename... Args>
         Builder& addDeathEffect(Args&&... args) {
-            return addDeathEffect(makeUniqueFunctor<Effect>, std::forward<Args>(args)...);
+            return addDeathEffect(constructFunctor<Effect>, std::forward<Args>(args)...);
         }
 
         template <typename Component>
             requires std::derived_from<std::remove_cvref_t<Component>, DeathEffect>
         Builder& addDeathEffect(Component&& component) {
             using ComponentVal = std::remove_cvref_t<Component>;
-            m_build->m_deathEffects.push_back(
-                std::make_unique<ComponentVal>(std::forward<Component>(component)));
+            nextDeathEffect().template emplace<ComponentVal>(std::forward<Component>(component));
             return *this;
         }
 
@@ -193,74 +191,50 @@ namespace Airplane {
 
         GameState& m_gameState;
 
-        template <typename Base, typename Factory, typename... Args> 
-            requires std::convertible_to<
-                std::invoke_result_t<Factory, Airplane::Airplane&, GameState&, Args...>, 
-                std::unique_ptr<Base>>
-        std::unique_ptr<Base> newComponentBy(Factory&& factory, Args&&... args) {
-            return std::invoke(std::forward<Factory>(factory), 
-                               *m_build, m_gameState, std::forward<Args>(args)...);
+        auto& nextDeathEffect() {
+            // effects are stored inline, more of them would be written past the array
+            if (m_build->m_deathEffectCount >= Airplane::MAX_DEATH_EFFECTS)
+                throw std::length_error{"Too many death effects, increase MAX_DEATH_EFFECTS"};
+            return m_build->m_deathEffects[m_build->m_deathEffectCount++];
         }
 
-        template <typename Base, typename Factory, typename... Args> 
-            requires std::derived_from<
-                std::invoke_result_t<Factory, Airplane::Airplane&, GameState&, Args...>, Base>
-        std::unique_ptr<Base> newComponentBy(Factory&& factory, Args&&... args) {
+        template <typename Holder, typename Factory, typename... Args> 
+            requires std::invocable<Factory, Airplane::Airplane&, GameState&, Args...>
+        void emplaceComponentBy(Holder& holder, Factory&& factory, Args&&... args) {
             using Component = std::invoke_result_t<Factory, Airplane::Airplane&, GameState&, Args...>;
-            return std::make_unique<Component>(
-                std::invoke(std::forward<Factory>(factory), 
-                            *m_build, m_gameState, std::forward<Args>(args)...));
-        }
-
-        template <typename Base, typename Factory, typename... Args> 
-            requires std::convertible_to<
-                std::invoke_result_t<Factory, GameState&, Args...>, 
-                std::unique_ptr<Base>>
-        std::unique_ptr<Base> newComponentBy(Factory&& factory, Args&&... args) {
-            return std::invoke(std::forward<Factory>(factory), m_gameState, std::forward<Args>(args)...);
+            holder.template emplaceBy<Component>([&]() {
+                return std::invoke(std::forward<Factory>(factory), 
+                                   *m_build, m_gameState, std::forward<Args>(args)...);
+            });
         }
 
-        template <typename Base, typename Factory, typename... Args> 
-            requires std::derived_from<
-                std::invoke_result_t<Factory, GameState&, Args...>, Base>
-        std::unique_ptr<Base> newComponentBy(Factory&& factory, Args&&... args) {
+        template <typename Holder, typename Factory, typename... Args> 
+            requires std::invocable<Factory, GameState&, Args...>
+        void emplaceComponentBy(Holder& holder, Factory&& factory, Args&&... args) {
             using Component = std::invoke_result_t<Factory, GameState&, Args...>;
-            return std::make_unique<Component>(
-                std::invoke(std::forward<Factory>(factory), m_gameState, std::forward<Args>(args)...));
+            holder.template emplaceBy<Component>([&]() {
+                return std::invoke(std::forward<Factory>(factory), 
+                                   m_gameState, std::forward<Args>(args)...);
+            });
         }
 
-        template <typename Base, typename Factory, typename... Args> 
-            requires std::convertible_to<
-                std::invoke_result_t<Factory, Airplane::Airplane&, Args...>, 
-                std::unique_ptr<Base>>
-        std::unique_ptr<Base> newComponentBy(Factory&& factory, Args&&... args) {
-            return std::invoke(std::forward<Factory>(factory), *m_build, std::forward<Args>(args)...);
-        }
-
-        template <typename Base, typename Factory, typename... Args> 
-            requires std::derived_from<
-                std::invoke_result_t<Factory, Airplane::Airplane&, Args...>, Base>
-        std::unique_ptr<Base> newComponentBy(Factory&& factory, Args&&... args) {
+        template <typename Holder, typename Factory, typename... Args> 
+            requires std::invocable<Factory, Airplane::Airplane&, Args...>
+        void emplaceComponentBy(Holder& holder, Factory&& factory, Args&&... args) {
             using Component = std::invoke_result_t<Factory, Airplane::Airplane&, Args...>;
-            return std::make_unique<Component>(
-                std::invoke(std::forward<Factory>(factory), *m_build, std::forward<Args>(args)...));
-        }
-
-        template <typename Base, typename Factory, typename... Args> 
-            requires std::convertible_to<
-                std::invoke_result_t<Factory, Args...>, 
-                std::unique_ptr<Base>>
-        std::unique_ptr<Base> newComponentBy(Factory&& factory, Args&&... args) {
-            return std::invoke(std::forward<Factory>(factory), std::forward<Args>(args)...);
+            holder.template emplaceBy<Component>([&]() {
+                return std::invoke(std::forward<Factory>(factory), 
+                                   *m_build, std::forward<Args>(args)...);
+            });
         }
 
-        template <typename Base, typename Factory, typename... Args> 
-            requires std::derived_from<
-                std::invoke_result_t<Factory, Args...>, Base>
-        std::unique_ptr<Base> newComponentBy(Factory&& factory, Args&&... args) {
+        template <typename Holder, typename Factory, typename... Args> 
+            requires std::invocable<Factory, Args...>
+        void emplaceComponentBy(Holder& holder, Factory&& factory, Args&&... args) {
             using Component = std::invoke_result_t<Factory, Args...>;
-            return std::make_unique<Component>(
-                std::invoke(std::forward<Factory>(factory), std::forward<Args>(args)...));
+            holder.template emplaceBy<Component>([&]() {
+                return std::invoke(std::forward<Factory>(factory), std::forward<Args>(args)...);
+            });
         }
     };
 
@@ -20,6 +20,7 @@ If not, see <https://www.gnu.org/licenses/>. */
 
 #include "../GameState.h"
 #include "../Pickup.h"
+#include "../algorithm.h"
 
 #include "../declarations.h"
 
@@ -55,6 +56,9 @@ namespace Airplane {
         LootDeathEffect(Airplane& owner, GameState& gameState) noexcept : 
             m_owner{owner}, m_gameState{gameState} {}
 
+        LootDeathEffect(const LootDeathEffect& other, Airplane& owner) noexcept : 
+            m_owner{owner}, m_gameState{other.m_gameState} {}
+
         void handleDeath() override {
             if (m_owner.hasBomb()) {
                 m_gameState.getEntities().addEntity<BombPickup>(m_owner.getPosition());
@@ -74,6 +78,9 @@ namespace Airplane {
         ExplosionDeathEffect(Airplane& owner, GameState& gameState) noexcept : 
             m_owner{owner}, m_gameState{gameState} {}
 
+        ExplosionDeathEffect(const ExplosionDeathEffect& other, Airplane& owner) noexcept : 
+            m_owner{owner}, m_gameState{other.m_gameState} {}
+
         void handleDeath() override {
             auto& entities = m_gameState.getEntities();
             auto particle = entities.createEntity<AnimatedParticleAir>(
@@ -81,7 +88,8 @@ namespace Airplane {
             particle->setPosition(m_owner.getPosition());
             entities.addEntity(std::move(particle));
             
-            m_gameState.getSounds().addSound(m_gameState.getAssets().getRandomExplosionSound());
+            auto& sound = random_element(m_gameState.getAssets().getExplosionSounds(), m_gameState.getRandomEngine());
+            m_gameState.getSounds().addSoundAt(sound, m_owner.getPosition().x, SoundManager::HIGH_PRIORITY);
         }
     private:
         Airplane& m_owner;
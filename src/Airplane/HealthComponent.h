@@ -14,18 +14,15 @@ If not, see <https://www.gnu.org/licenses/>. */
 #ifndef AIRPLANE_HEALTH_COMPONENT_H_
 #define AIRPLANE_HEALTH_COMPONENT_H_
 
-#include "../Timer.h"
-
 #include <SFML/System.hpp>
 
 namespace Airplane {
     class HealthComponent {
     public:
-        HealthComponent() : m_health{0}, m_maxHealth{0} {}
+        // in seconds
+        static const constexpr float DAMAGE_COOLDOWN = 0.1f;
 
-        void update(sf::Time elapsedTime) noexcept {
-            m_damageCooldown.update(elapsedTime);
-        }
+        HealthComponent() : m_health{0}, m_maxHealth{0}, m_inDamageCooldown{false} {}
 
         int getHealth() const noexcept {
             return m_health;
@@ -44,25 +41,31 @@ namespace Airplane {
                 return false;
         }
 
+        bool canBeDamaged() const noexcept {
+            return !m_inDamageCooldown;
+        }
+
+        // owner schedules endDamageCooldown after DAMAGE_COOLDOWN
         // return true if killed
         bool damage() noexcept {
-            if (m_damageCooldown.isFinished()) {
-                m_damageCooldown.start(sf::seconds(0.1f));
+            m_inDamageCooldown = true;
 
-                -- m_health;
-                return isDead();
-            } else
-                return false;
+            -- m_health;
+            return isDead();
+        }
+
+        void endDamageCooldown() noexcept {
+            m_inDamageCooldown = false;
         }
 
         bool shouldDraw() const noexcept {
-            return m_damageCooldown.isFinished();
+            return !m_inDamageCooldown;
         }
     private:
         int m_health;
         int m_maxHealth;
 
-        OnceTimer m_damageCooldown;
+        bool m_inDamageCooldown;
 
         void setMaxHealth(int maxHealth) noexcept {
             m_health = maxHealth;
@@ -0,0 +1,120 @@
+/* This file is part of Jutchs Shmup.
+
+Jutchs Shmup is free software: you can redistribute it and/or modify it
+under the terms of the GNU General Public License as published by the Free Software Foundation,
+either version 3 of the License, or (at your option) any later version.
+
+Jutchs Shmup is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with Jutchs Shmup.
+If not, see <https://www.gnu.org/licenses/>. */
+
+#ifndef AIRPLANE_INLINE_COMPONENT_H_
+#define AIRPLANE_INLINE_COMPONENT_H_
+
+#include "../declarations.h"
+
+#include <concepts>
+#include <functional>
+#include <memory>
+#include <cstddef>
+
+namespace Airplane {
+    // copy of the component for another airplane
+    // components referencing their owner provide Component(const Component&, Airplane&)
+    template <typename Component>
+    Component copyFor(const Component& component, Airplane& owner) {
+        if constexpr (std::constructible_from<Component, const Component&, Airplane&>)
+            return Component(component, owner);
+        else
+            return Component(component);
+    }
+
+    // holds a component derived from Base in a buffer inside the owner
+    // so components don't need their own heap allocations
+    template <typename Base, size_t capacity>
+    class InlineComponent {
+    public:
+        InlineComponent() noexcept : m_component{nullptr}, m_copyTo{nullptr} {}
+
+        // components keep pointers to their owner so they are never copied or moved
+        InlineComponent(const InlineComponent&) = delete;
+        InlineComponent& operator = (const InlineComponent&) = delete;
+
+        ~InlineComponent() {
+            reset();
+        }
+
+        // Factory must return Component by value, it's constructed in place
+        template <std::derived_from<Base> Component, std::invocable Factory>
+        Component& emplaceBy(Factory&& factory) {
+            static_assert(sizeof(Component) <= capacity,
+                          "component doesn't fit, increase capacity");
+            static_assert(alignof(Component) <= alignof(std::max_align_t),
+                          "component is overaligned");
+
+            reset();
+            Component* component = ::new (static_cast<void*>(m_storage))
+                Component(std::invoke(std::forward<Factory>(factory)));
+            m_component = component;
+            m_copyTo = &copyTo<Component>;
+            return *component;
+        }
+
+        template <std::derived_from<Base> Component, typename... Args>
+            requires std::constructible_from<Component, Args...>
+        Component& emplace(Args&&... args) {
+            return emplaceBy<Component>([&args...]() {
+                return Component(std::forward<Args>(args)...);
+            });
+        }
+
+        // use instead of copy constructor so copied components reference the new owner
+        void copyFrom(const InlineComponent& other, Airplane& owner) {
+            if (other.m_component)
+                other.m_copyTo(*other.m_component, *this, owner);
+            else
+                reset();
+        }
+
+        void reset() noexcept {
+            if (m_component) {
+                std::destroy_at(m_component);
+                m_component = nullptr;
+            }
+        }
+
+        explicit operator bool() const noexcept {
+            return m_component;
+        }
+
+        Base* operator -> () noexcept {
+            return m_component;
+        }
+
+        const Base* operator -> () const noexcept {
+            return m_component;
+        }
+
+        Base& operator * () noexcept {
+            return *m_component;
+        }
+
+        const Base& operator * () const noexcept {
+            return *m_component;
+        }
+    private:
+        alignas(std::max_align_t) std::byte m_storage[capacity];
+        Base* m_component;
+        void (*m_copyTo)(const Base& component, InlineComponent& to, Airplane& owner);
+
+        template <typename Component>
+        static void copyTo(const Base& component, InlineComponent& to, Airplane& owner) {
+            to.template emplace<Component>(copyFor(static_cast<const Component&>(component), owner));
+        }
+    };
+}
+
+#endif
@@ -15,6 +15,7 @@ If not, see <https://www.gnu.org/licenses/>. */
 #define AIRPLANE_LOGIC_SHOOT_CONTROL_COMPONENTS_H_
 
 #include "ShootControlComponent.h"
+#include "InlineComponent.h"
 
 #include "../declarations.h"
 
@@ -43,6 +44,9 @@ namespace Airplane {
         public:
             explicit NotShootControlComponent(Component component) : 
                 m_component{std::move(component)} {}
+
+            NotShootControlComponent(const NotShootControlComponent& other, Airplane& owner) : 
+                m_component{copyFor(other.m_component, owner)} {}
             
             bool shouldShoot() override {
                 return !m_component.shouldShoot();
@@ -80,6 +84,10 @@ namespace Airplane {
         public:
             BinaryShootControlComponent(Component1 component1, Component2 component2) :
                 m_component1{std::move(component1)}, m_component2{std::move(component2)} {}
+
+            BinaryShootControlComponent(const BinaryShootControlComponent& other, Airplane& owner) :
+                m_component1{copyFor(other.m_component1, owner)}, 
+                m_component2{copyFor(other.m_component2, owner)} {}
         protected:
             bool shouldShoot1() {
                 return m_component1.shouldShoot();
@@ -47,28 +47,39 @@ namespace Airplane {
         }
     }
 
-    void PeriodicalMoveComponent::update(sf::Time elapsedTime) {
-        auto moved = m_speed * elapsedTime.asSeconds();
-
-        auto [minY, maxY] = detail::getMinmaxYFor(m_owner, m_gameState); 
-
-        float deltaY = m_moveUp ? moved.y : -moved.y;
-        if (maxY - minY < 2 * m_owner.getGlobalBounds().height) {
-            deltaY = 0.f;
+    namespace detail {
+        float getPeriodicalYFor(Airplane& airplane, GameState& gameState, float movedY, bool& moveUp) {
+            auto [minY, maxY] = getMinmaxYFor(airplane, gameState); 
+
+            float deltaY = moveUp ? movedY : -movedY;
+            if (maxY - minY < 2 * airplane.getGlobalBounds().height) {
+                deltaY = 0.f;
+            }
+
+            float y = airplane.getPosition().y + deltaY;
+            if (y > maxY) {
+                y = airplane.getPosition().y - deltaY;
+                moveUp = false;
+            } else if (y < minY) {
+                y = airplane.getPosition().y - deltaY;
+                moveUp = true;
+            }
+            return y;
         }
+    }
 
-        float y = m_owner.getPosition().y + deltaY;
-        if (y > maxY) {
-            y = m_owner.getPosition().y - deltaY;
-            m_moveUp = false;
-        } else if (y < minY) {
-            y = m_owner.getPosition().y - deltaY;
-            m_moveUp = true;
-        }
-        
+    void PeriodicalMoveComponent::update(sf::Time elapsedTime) {
+        auto moved = m_speed * elapsedTime.asSeconds();
+        float y = detail::getPeriodicalYFor(m_owner, m_gameState, moved.y, m_moveUp);
         m_owner.setPosition(m_owner.getPosition().x - moved.x, y);
     }
 
+    void AutopilotMoveComponent::update(sf::Time elapsedTime) {
+        auto moved = m_speed * elapsedTime.asSeconds();
+        float y = detail::getPeriodicalYFor(m_owner, m_gameState, moved.y, m_moveUp);
+        m_owner.setPosition(m_owner.getPosition().x + moved.x, y);
+    }
+
     void PlayerMoveComponent::update(sf::Time elapsedTime) {
         auto [movedX, movedY] = getMoved(elapsedTime);
 
@@ -24,12 +24,18 @@ If not, see <https://www.gnu.org/licenses/>. */
 namespace Airplane {
     namespace detail {
         std::tuple<float, float> getMinmaxYFor(Airplane& airplane, GameState& gameState);
+
+        // move up or down by movedY turning back near obstacles
+        float getPeriodicalYFor(Airplane& airplane, GameState& gameState, float movedY, bool& moveUp);
     }
 
     class BasicMoveComponent : public MoveComponent {
     public:
         BasicMoveComponent(Airplane& owner) : m_owner{owner} {}
 
+        BasicMoveComponent(const BasicMoveComponent& other, Airplane& owner) noexcept : 
+            MoveComponent{other}, m_owner{owner} {}
+
         void update(sf::Time elapsedTime) noexcept override {
             auto moved = m_speed * elapsedTime.asSeconds();
             m_owner.move(-moved.x, 0.f);
@@ -47,6 +53,9 @@ namespace Airplane {
         PeriodicalMoveComponent(Airplane& owner, GameState& gameState) noexcept : 
             m_moveUp{true}, m_owner{owner}, m_gameState{gameState} {}
 
+        PeriodicalMoveComponent(const PeriodicalMoveComponent& other, Airplane& owner) noexcept : 
+            MoveComponent{other}, m_moveUp{other.m_moveUp}, m_owner{owner}, m_gameState{other.m_gameState} {}
+
         void update(sf::Time elapsedTime) override;
 
         sf::Vector2f getMinSpeed() const noexcept override {
@@ -66,6 +75,10 @@ namespace Airplane {
                                     TargetGetter getTarget) noexcept : 
             m_getTarget{std::move(getTarget)}, m_owner{owner}, m_gameState{gameState} {}
 
+        LineWithTargetMoveComponent(const LineWithTargetMoveComponent& other, Airplane& owner) : 
+            MoveComponent{other}, m_getTarget{other.m_getTarget}, 
+            m_owner{owner}, m_gameState{other.m_gameState} {}
+
         void update(sf::Time elapsedTime) override;
 
         sf::Vector2f getMinSpeed() const noexcept override {
@@ -81,8 +94,8 @@ namespace Airplane {
             []<typename TargetGetter>(Airplane& owner, GameState& gameState, TargetGetter&& getTarget) 
             requires std::convertible_to<std::invoke_result_t<TargetGetter, const Airplane&>, 
                                          sf::Vector2f> {
-        using Component = LineWithTargetMoveComponent<TargetGetter>;
-        return std::make_unique<Component>(owner, gameState, std::forward<TargetGetter>(getTarget));
+        using Component = LineWithTargetMoveComponent<std::remove_cvref_t<TargetGetter>>;
+        return Component(owner, gameState, std::forward<TargetGetter>(getTarget));
     };
 
     template <typename TargetGetter>
@@ -113,12 +126,35 @@ namespace Airplane {
         PlayerMoveComponent(Airplane& owner, GameState& gameState) noexcept : 
             m_owner{owner}, m_gameState{gameState} {}
 
+        PlayerMoveComponent(const PlayerMoveComponent& other, Airplane& owner) noexcept : 
+            MoveComponent{other}, m_owner{owner}, m_gameState{other.m_gameState} {}
+
+        void update(sf::Time elapsedTime) override;
+
+        sf::Vector2f getMinSpeed() const noexcept override {
+            return {m_speed.x, 0};
+        }
+    private:
+        Airplane& m_owner;
+        GameState& m_gameState;
+    };
+
+    // flies player forward without input, used in headless games
+    class AutopilotMoveComponent : public MoveComponent {
+    public:
+        AutopilotMoveComponent(Airplane& owner, GameState& gameState) noexcept : 
+            m_moveUp{true}, m_owner{owner}, m_gameState{gameState} {}
+
+        AutopilotMoveComponent(const AutopilotMoveComponent& other, Airplane& owner) noexcept : 
+            MoveComponent{other}, m_moveUp{other.m_moveUp}, m_owner{owner}, m_gameState{other.m_gameState} {}
+
         void update(sf::Time elapsedTime) override;
 
         sf::Vector2f getMinSpeed() const noexcept override {
             return {m_speed.x, 0};
         }
     private:
+        bool m_moveUp;
         Airplane& m_owner;
         GameState& m_gameState;
     };
@@ -15,7 +15,7 @@ If not, see <https://www.gnu.org/licenses/>. */
 
 #include "Airplane.h"
 
-#include "../SoundEffect.h"
+#include "../SoundManager.h"
 #include "../Bullet.h"
 
 #include "../algorithm.h"
@@ -44,19 +44,35 @@ namespace Airplane {
         m_localAffectedArea = {minX - bulletSize.x / 2.f, minY - bulletSize.x / 2.f, 
                                INFINITY, maxY - minY + bulletSize.x};
         
-        m_shootTimer.setMaxSteps(std::ssize(pattern));
-        m_shootTimer.finish();
+        m_step = static_cast<int>(std::ssize(pattern));
+        m_waiting = false;
     }
 
-    void ShootComponent::update(sf::Time elapsedTime) {
-        m_shootTimer.update(elapsedTime);
-        
-        if (m_shootTimer.canStep()) shotSound();
+    void ShootComponent::handleTimer() {
+        m_waiting = false;
+
+        // coasting airplanes don't shoot, rest of the pattern is dropped
+        if (!m_gameState.inNearArea(m_owner.getGlobalBounds()))
+            m_step = static_cast<int>(std::ssize(m_pattern));
+
+        if (m_step < std::ssize(m_pattern)) 
+            shootSteps();
+    }
 
-        m_shootTimer.forEachStep([this](int step) {
-            spawnBullet(m_pattern[step].offset);
-            return m_pattern[step].delay;
-        });
+    void ShootComponent::shootSteps() {
+        shotSound();
+
+        sf::Time delay = sf::Time::Zero;
+        while (delay == sf::Time::Zero && m_step < std::ssize(m_pattern)) {
+            spawnBullet(m_pattern[m_step].offset);
+            delay = m_pattern[m_step].delay;
+            ++ m_step;
+        }
+
+        if (delay > sf::Time::Zero) {
+            m_waiting = true;
+            m_gameState.getTimers().schedule(delay, {m_owner.getId(), Airplane::SHOOT_TIMER});
+        }
     }
 
     void ShootComponent::spawnBullet(sf::Vector2f offset) const {
@@ -65,7 +81,8 @@ namespace Airplane {
     }
 
     void ShootComponent::shotSound() const {
-        m_gameState.getSounds().addSound(m_gameState.getAssets().getRandomShotSound());
+        auto& sound = random_element(m_gameState.getAssets().getShotSounds(), m_gameState.getRandomEngine());
+        m_gameState.getSounds().addSoundAt(sound, m_owner.getPosition().x);
     }
 
     sf::FloatRect ShootComponent::getGlobalAffectedArea() const noexcept {
@@ -14,8 +14,6 @@ If not, see <https://www.gnu.org/licenses/>. */
 #ifndef AIRPLANE_SHOOT_COMPONENT_H_
 #define AIRPLANE_SHOOT_COMPONENT_H_
 
-#include "../Timer.h"
-
 #include "../declarations.h"
 
 #include <SFML/Graphics.hpp>
@@ -33,19 +31,32 @@ namespace Airplane {
         using Pattern = std::span<PatternElement>;
 
         ShootComponent(Airplane& owner, GameState& gameState) noexcept :
-            m_owner{owner}, m_gameState{gameState} {}
-
-        void update(sf::Time elapsedTime);
-
-        void trySetShouldShoot() noexcept {
-            m_shootTimer.tryRestart();
+            m_step{0}, m_waiting{false}, m_owner{owner}, m_gameState{gameState} {}
+
+        ShootComponent(const ShootComponent& other, Airplane& owner) noexcept :
+            m_step{other.m_step}, m_waiting{other.m_waiting}, m_pattern{other.m_pattern}, 
+            m_localAffectedArea{other.m_localAffectedArea}, 
+            m_owner{owner}, m_gameState{other.m_gameState} {}
+
+        // start the pattern if the previous one has finished
+        void trySetShouldShoot() {
+            if (!m_waiting && m_step == std::ssize(m_pattern)) {
+                m_step = 0;
+                shootSteps();
+            }
         }
 
+        // called by owner when the delay of the last shot step passes
+        void handleTimer();
+
         // width  can be infinite
         // height can be infinite and/or negative
         sf::FloatRect getGlobalAffectedArea() const noexcept;
     private:
-        StepTimer m_shootTimer;
+        // next step of the pattern, pattern size if it's finished
+        int m_step;
+        // for delay after the last shot step
+        bool m_waiting;
 
         Pattern m_pattern;
 
@@ -57,6 +68,9 @@ namespace Airplane {
         Airplane& m_owner;
         GameState& m_gameState;
 
+        // shoot steps until one with delay
+        void shootSteps();
+
         void spawnBullet(sf::Vector2f offset) const;
         void shotSound() const;
 
@@ -45,6 +45,10 @@ namespace Airplane {
         TargetPlayerShootControlComponent(Airplane& owner, GameState& gameState) noexcept : 
             m_owner{owner}, m_gameState{gameState} {}
 
+        TargetPlayerShootControlComponent(const TargetPlayerShootControlComponent& other, 
+                                          Airplane& owner) noexcept : 
+            m_owner{owner}, m_gameState{other.m_gameState} {}
+
         bool shouldShoot() noexcept override {
             return intersects(m_gameState.getEntities().getPlayerGlobalBounds(),
                             m_owner.getShootGlobalAffectedArea());
@@ -59,6 +63,10 @@ namespace Airplane {
         CanHitPlayerShootControlComponent(Airplane& owner, GameState& gameState) noexcept : 
             m_owner{owner}, m_gameState{gameState} {}
 
+        CanHitPlayerShootControlComponent(const CanHitPlayerShootControlComponent& other, 
+                                          Airplane& owner) noexcept : 
+            m_owner{owner}, m_gameState{other.m_gameState} {}
+
         bool shouldShoot() override;
     private:
         Airplane& m_owner;
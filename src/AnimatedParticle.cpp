@@ -13,6 +13,8 @@ If not, see <https://www.gnu.org/licenses/>. */
 
 #include "AnimatedParticle.h"
 
+#include "GameState.h"
+
 #include <SFML/Graphics.hpp>
 #include <SFML/System.hpp>
 
@@ -21,18 +23,20 @@ using std::span;
 
 using std::ssize;
 
-AnimatedParticle::AnimatedParticle(span<const sf::Texture> animation, sf::Time delay) noexcept :
-        m_animation{animation}, m_delay{delay}, m_timer{std::ssize(m_animation)} {        
+AnimatedParticle::AnimatedParticle(GameState& gameState, 
+                                   span<const sf::Texture> animation, sf::Time delay) noexcept :
+        m_gameState{gameState}, m_savedPosition{}, m_animation{animation}, m_delay{delay}, m_frame{0} {        
     setTexture(m_animation[0]);
-    m_timer.wait(m_delay);
 }
 
-void AnimatedParticle::update(sf::Time elapsedTime) noexcept {
-    m_timer.update(elapsedTime);
-    m_timer.forEachStep([this](int){
-        return m_delay;
-    });
+void AnimatedParticle::handleAdded() {
+    m_gameState.getTimers().schedule(m_delay, {getId(), FRAME_TIMER});
+}
 
-    if (!m_timer.isReachedMaxStep())
-        setTexture(m_animation[m_timer.getStep()]);
+void AnimatedParticle::handleTimer(int) {
+    ++ m_frame;
+    if (m_frame < ssize(m_animation)) {
+        setTexture(m_animation[m_frame]);
+        m_gameState.getTimers().schedule(m_delay, {getId(), FRAME_TIMER});
+    }
 }
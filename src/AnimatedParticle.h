@@ -15,23 +15,40 @@ If not, see <https://www.gnu.org/licenses/>. */
 #define ANIMATED_PARTICLE_H_
 
 #include "Sprite.h"
-#include "Timer.h"
+#include "declarations.h"
 
 #include <SFML/Graphics.hpp>
 #include <SFML/System.hpp>
 
 #include <span>
+#include <optional>
 
 class AnimatedParticle : public CollidableBase<AnimatedParticle> {
 public:
-    void update(sf::Time elapsedTime) noexcept override;
+    void update(sf::Time) noexcept override {}
+
+    void handleAdded() override;
+
+    void handleTimer(int) override;
+
+    bool isUpdatedInParallel() const noexcept override {
+        return true;
+    }
 
     sf::FloatRect getGlobalBounds() const noexcept {
         return m_sprite.getGlobalBounds();
     }
 
     bool shouldBeDeleted() const noexcept override {
-        return m_timer.isReachedMaxStep();
+        return m_frame == std::ssize(m_animation);
+    }
+
+    void savePosition() noexcept override {
+        m_savedPosition = m_sprite.getPosition();
+    }
+
+    sf::Vector2f getStepMovement() const noexcept override {
+        return m_savedPosition ? m_sprite.getPosition() - *m_savedPosition : sf::Vector2f{0.f, 0.f};
     }
 
     void setPosition(sf::Vector2f position) noexcept {
@@ -54,19 +71,24 @@ public:
         setScale(scale, scale);
     }
 protected:
-    AnimatedParticle(std::span<const sf::Texture> animation, sf::Time delay) noexcept;
+    AnimatedParticle(GameState& gameState, std::span<const sf::Texture> animation, sf::Time delay) noexcept;
 
     void draw(sf::RenderTarget& target, 
               sf::RenderStates states = sf::RenderStates::Default) const noexcept {
         target.draw(m_sprite, states);
     }
 private:
+    GameState& m_gameState;
+
     sf::Sprite m_sprite;
+    std::optional<sf::Vector2f> m_savedPosition;
 
     std::span<const sf::Texture> m_animation;
     sf::Time m_delay;
 
-    StepTimer m_timer;
+    int m_frame;
+
+    static const constexpr int FRAME_TIMER = 0;
 
     void setTexture(const sf::Texture& texture) noexcept {
         m_sprite.setTexture(texture);
@@ -78,24 +100,34 @@ private:
 
 class AnimatedParticleAir : public AnimatedParticle {
 public:
-    AnimatedParticleAir(std::span<const sf::Texture> animation, sf::Time delay) noexcept :
-        AnimatedParticle(animation, delay) {}
+    AnimatedParticleAir(GameState& gameState, 
+                        std::span<const sf::Texture> animation, sf::Time delay) noexcept :
+        AnimatedParticle(gameState, animation, delay) {}
 
     void drawAir(sf::RenderTarget& target, 
               sf::RenderStates states = sf::RenderStates::Default) const noexcept override {
         draw(target, states);
     }
+
+    std::unique_ptr<Entity> clone() const override {
+        return std::make_unique<AnimatedParticleAir>(*this);
+    }
 };
 
 class AnimatedParticleLand : public AnimatedParticle {
 public:
-    AnimatedParticleLand(std::span<const sf::Texture> animation, sf::Time delay) noexcept :
-        AnimatedParticle(animation, delay) {}
+    AnimatedParticleLand(GameState& gameState, 
+                        std::span<const sf::Texture> animation, sf::Time delay) noexcept :
+        AnimatedParticle(gameState, animation, delay) {}
 
     void drawLand(sf::RenderTarget& target, 
               sf::RenderStates states = sf::RenderStates::Default) const noexcept override {
         draw(target, states);
     }
+
+    std::unique_ptr<Entity> clone() const override {
+        return std::make_unique<AnimatedParticleLand>(*this);
+    }
 };
 
 #endif
\ No newline at end of file
@@ -16,9 +16,17 @@ If not, see <https://www.gnu.org/licenses/>. */
 #include <SFML/Graphics.hpp>
 #include <SFML/System.hpp>
 
+#include <array>
 #include <format>
+#include <algorithm>
+#include <utility>
 
-AssetManager::AssetManager(std::mt19937_64& randomEngine) : m_randomEngine{randomEngine} {    
+namespace {
+    // most of generated tiles
+    const std::array COMMON_LAND{Land::PLAINS2, Land::WATER, Land::TREE, Land::TREES, Land::BUSH};
+}
+
+AssetManager::AssetManager() : m_landTextureSize{0, 0} {    
     if (!m_bulletTexture.loadFromFile("resources/textures/kenney_pixelshmup/Tiles/tile_0000.png"))
         throw TextureLoadError{"Can't load bullet texture"};
 
@@ -51,11 +59,10 @@ AssetManager::AssetManager(std::mt19937_64& randomEngine) : m_randomEngine{rando
             throw TextureLoadError{std::format("Can't load {} airplane texture", getTextureName(flags))};
     }
 
-    forValidLand([&landTextures = m_landTextures](Land land) {
-        if (!landTextures[static_cast<std::underlying_type_t<Land>>(land)]
-            .loadFromFile(("resources/textures/Land/" / getTextureFileName(land)).generic_string()))
-            throw TextureLoadError{std::format("Can't load {} tile texture", getName(land))};
-    });
+    // other land variants are loaded when they are drawn
+    m_landTextureSize = m_landTextures.get(Land::PLAINS).getSize();
+    for (Land land : COMMON_LAND)
+        m_landTextures.prefetch(land);
 
     if (!m_healthTexture.loadFromFile("resources/textures/kenney_pixelshmup/Tiles/tile_0026.png"))
         throw TextureLoadError{"Can't load health texture"};
@@ -73,6 +80,8 @@ AssetManager::AssetManager(std::mt19937_64& randomEngine) : m_randomEngine{rando
         if (!m_digitTextures[i].loadFromFile(
                 std::format("resources/textures/Digits/digit_{}.png", i))) 
             throw TextureLoadError{std::format("Can't load digit {} texture", i)};
+
+    createHudTexture();
     
     for (int i = 0; i < std::size(m_explosionSounds); ++ i) 
         if (!m_explosionSounds[i].loadFromFile(
@@ -92,3 +101,36 @@ AssetManager::AssetManager(std::mt19937_64& randomEngine) : m_randomEngine{rando
     if (!m_font.loadFromFile("resources/fonts/Roboto/Roboto-Medium.ttf")) 
         throw FontLoadError{std::format("Can't load font")};
 }
+
+
+void AssetManager::createHudTexture() {
+    std::vector<std::pair<const sf::Texture*, sf::IntRect*>> parts;
+    for (int i = 0; i < std::ssize(m_digitTextures); ++ i)
+        parts.emplace_back(&m_digitTextures[i], &m_hudDigitRects[i]);
+    parts.emplace_back(&m_plusTexture, &m_hudPlusRect);
+    parts.emplace_back(&m_minusTexture, &m_hudMinusRect);
+    parts.emplace_back(&m_slashTexture, &m_hudSlashRect);
+    parts.emplace_back(&m_healthTexture, &m_hudHealthRect);
+
+    // place all parts in one row
+    sf::Vector2u atlasSize{0, 0};
+    for (auto [texture, rect] : parts) {
+        atlasSize.x += texture->getSize().x;
+        atlasSize.y = std::max(texture->getSize().y, atlasSize.y);
+    }
+
+    sf::Image atlas;
+    atlas.create(atlasSize.x, atlasSize.y, sf::Color::Transparent);
+
+    unsigned int x = 0;
+    for (auto [texture, rect] : parts) {
+        atlas.copy(texture->copyToImage(), x, 0);
+
+        auto size = texture->getSize();
+        *rect = sf::IntRect(x, 0, size.x, size.y);
+        x += size.x;
+    }
+
+    if (!m_hudTexture.loadFromImage(atlas))
+        throw TextureLoadError{"Can't create HUD texture"};
+}
\ No newline at end of file
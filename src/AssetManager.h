@@ -16,19 +16,26 @@ If not, see <https://www.gnu.org/licenses/>. */
 
 #include "Airplane/Flags.h"
 #include "Land.h"
+#include "LandTextureCache.h"
 
 #include <SFML/Graphics.hpp>
 #include <SFML/System.hpp>
 #include <SFML/Audio.hpp>
 
-#include <random>
 #include <vector>
+#include <span>
 #include <array>
 #include <concepts>
 
 class AssetManager {
 public:
-    AssetManager(std::mt19937_64& randomEngine);
+    // loads everything except land textures at once and checks that land files exist
+    // land textures are loaded on demand by a thread-safe cache, nothing else changes after that
+    // so one instance is shared by all game states through shared_ptr<const AssetManager>
+    AssetManager();
+
+    AssetManager(const AssetManager&) = delete;
+    AssetManager& operator = (const AssetManager&) = delete;
 
     const sf::Texture& getBulletTexture() const noexcept {
         return m_bulletTexture;
@@ -67,12 +74,20 @@ public:
         return m_airplaneTextures[0].getSize();
     }
 
-    const sf::Texture& getLandTexture(Land land) const noexcept {
-        return m_landTextures[static_cast<std::underlying_type_t<Land>>(land)];
+    // loaded on the first call, must be called from the drawing thread
+    // throws TextureLoadError if the file can't be decoded
+    const sf::Texture& getLandTexture(Land land) const {
+        return m_landTextures.get(land);
+    }
+
+    // start decoding a land variant in background so drawing it first time doesn't stall
+    void prefetchLandTexture(Land land) const {
+        m_landTextures.prefetch(land);
     }
 
+    // all land variants have the same size
     sf::Vector2u getLandTextureSize() const noexcept {
-        return m_landTextures[0].getSize();
+        return m_landTextureSize;
     }
 
     const sf::Texture& getHealthTexture() const noexcept {
@@ -95,19 +110,42 @@ public:
         return m_digitTextures;
     }
 
-    const sf::SoundBuffer& getRandomExplosionSound() const noexcept {
-        auto ditribution = std::uniform_int_distribution<int64_t>(0, std::ssize(m_explosionSounds) - 1);
-        return m_explosionSounds[ditribution(m_randomEngine)];
+    // digits, signs, slash and health packed together so HUD can be drawn in one call
+    const sf::Texture& getHudTexture() const noexcept {
+        return m_hudTexture;
+    }
+
+    sf::IntRect getHudDigitRect(int digit) const noexcept {
+        return m_hudDigitRects[digit];
+    }
+
+    sf::IntRect getHudPlusRect() const noexcept {
+        return m_hudPlusRect;
+    }
+
+    sf::IntRect getHudMinusRect() const noexcept {
+        return m_hudMinusRect;
+    }
+
+    sf::IntRect getHudSlashRect() const noexcept {
+        return m_hudSlashRect;
+    }
+
+    sf::IntRect getHudHealthRect() const noexcept {
+        return m_hudHealthRect;
+    }
+
+    // variants of a sound, callers choose one with their own random engine
+    std::span<const sf::SoundBuffer> getExplosionSounds() const noexcept {
+        return m_explosionSounds;
     }
 
-    const sf::SoundBuffer& getRandomShotSound() const noexcept {
-        auto ditribution = std::uniform_int_distribution<int64_t>(0, std::ssize(m_shotSounds) - 1);
-        return m_shotSounds[ditribution(m_randomEngine)];
+    std::span<const sf::SoundBuffer> getShotSounds() const noexcept {
+        return m_shotSounds;
     }
 
-    const sf::SoundBuffer& getRandomPowerUpSound() const noexcept {
-        auto ditribution = std::uniform_int_distribution<int64_t>(0, std::ssize(m_powerUpSounds) - 1);
-        return m_powerUpSounds[ditribution(m_randomEngine)];
+    std::span<const sf::SoundBuffer> getPowerUpSounds() const noexcept {
+        return m_powerUpSounds;
     }
 
     const sf::Font& getFont() const noexcept {
@@ -126,7 +164,9 @@ private:
 
     std::array<sf::Texture, Airplane::TEXTURE_VARIANTS> m_airplaneTextures;
 
-    std::array<sf::Texture, LAND_VARIANTS> m_landTextures;
+    // loading on demand doesn't change any observable state
+    mutable LandTextureCache m_landTextures;
+    sf::Vector2u m_landTextureSize;
 
     sf::Texture m_healthTexture;
     sf::Texture m_plusTexture;
@@ -134,13 +174,20 @@ private:
     sf::Texture m_slashTexture;
     std::array<sf::Texture, 10> m_digitTextures;
 
+    sf::Texture m_hudTexture;
+    std::array<sf::IntRect, 10> m_hudDigitRects;
+    sf::IntRect m_hudPlusRect;
+    sf::IntRect m_hudMinusRect;
+    sf::IntRect m_hudSlashRect;
+    sf::IntRect m_hudHealthRect;
+
     std::array<sf::SoundBuffer, 5> m_explosionSounds;
     std::array<sf::SoundBuffer, 5> m_shotSounds;
     std::array<sf::SoundBuffer, 12> m_powerUpSounds;
 
     sf::Font m_font;
 
-    std::mt19937_64& m_randomEngine;
+    void createHudTexture();
 };
 
 class AssetLoadError : public std::runtime_error {
@@ -13,8 +13,12 @@ If not, see <https://www.gnu.org/licenses/>. */
 
 #include "Bomb.h"
 
+#include "algorithm.h"
+
+#include <cmath>
+
 Bomb::Bomb(GameState& gameState, bool playerSide, sf::Vector2f position) :
-        Sprite{gameState}, m_launched{gameState.getCurrentTime()}, m_alive{true} {
+        Sprite{gameState}, m_age{sf::Time::Zero}, m_alive{true} {
     auto& texture = gameState.getAssets().getBombTexture();
     setTexture(texture);
 
@@ -25,28 +29,35 @@ Bomb::Bomb(GameState& gameState, bool playerSide, sf::Vector2f position) :
     setRotation(playerSide ? 90.f : -90.f);
 }
 
-void Bomb::update(sf::Time elapsedTime) {
-    float t = (m_gameState.getCurrentTime() - m_launched).asSeconds();
+void Bomb::update(sf::Time elapsedTime) noexcept {
+    m_age += elapsedTime;
+
+    float t = m_age.asSeconds();
+    setScale(1.f / (1.f + 10.f * t * t));
+}
+
+void Bomb::handleAdded() {
+    // bomb falls until 10 t^2 reaches 1
+    m_gameState.getTimers().schedule(sf::seconds(std::sqrt(0.1f)), {getId(), EXPLODE_TIMER});
+}
 
-    float y = 10.f * t * t;
-    if (y > 1.f) {
-        m_alive = false;
+void Bomb::handleTimer(int) {
+    m_alive = false;
 
-        auto& entities = m_gameState.getEntities();
+    auto& entities = m_gameState.getEntities();
 
-        const float radius = 24.f;
+    const float radius = 24.f;
 
-        m_gameState.getLand().handleBombExplosion(getPosition());
-        entities.handleBombExplosion(getPosition(), radius);
+    m_gameState.getLand().handleBombExplosion(getPosition());
+    entities.handleBombExplosion(getPosition(), radius);
 
-        auto particle = entities.createEntity<AnimatedParticleLand>(
-            static_cast<std::span<const sf::Texture>>(m_gameState.getAssets().getExplosionAnimation()), 
-            sf::seconds(0.1f));
-        particle->setPosition(getPosition());
-        particle->setScale(radius / m_gameState.getAssets().getExplosionAnimation()[0].getSize().x);
-        entities.addEntity(std::move(particle));
+    auto particle = entities.createEntity<AnimatedParticleLand>(
+        static_cast<std::span<const sf::Texture>>(m_gameState.getAssets().getExplosionAnimation()), 
+        sf::seconds(0.1f));
+    particle->setPosition(getPosition());
+    particle->setScale(radius / m_gameState.getAssets().getExplosionAnimation()[0].getSize().x);
+    entities.addEntity(std::move(particle));
 
-        m_gameState.getSounds().addSound(m_gameState.getAssets().getRandomExplosionSound());
-    }
-    setScale(1.f / (1.f + y));
+    auto& sound = random_element(m_gameState.getAssets().getExplosionSounds(), m_gameState.getRandomEngine());
+    m_gameState.getSounds().addSoundAt(sound, getPosition().x, SoundManager::HIGH_PRIORITY);
 }
@@ -25,14 +25,28 @@ class Bomb : public Sprite, public CollidableBase<Bomb> {
 public:
     Bomb(GameState& gameState, bool playerSide, sf::Vector2f position);
 
-    void update(sf::Time elapsedTime) override;
+    void update(sf::Time elapsedTime) noexcept override;
+
+    bool isUpdatedInParallel() const noexcept override {
+        return true;
+    }
+
+    void handleAdded() override;
+
+    void handleTimer(int type) override;
 
     bool shouldBeDeleted() const noexcept override {
         return !(m_alive && m_gameState.inActiveArea(getPosition().x));
     }
+
+    std::unique_ptr<Entity> clone() const override {
+        return std::make_unique<Bomb>(*this);
+    }
 private:
-    sf::Time m_launched;
+    sf::Time m_age;
     bool m_alive;
+
+    static const constexpr int EXPLODE_TIMER = 0;
 };
 
 #endif
\ No newline at end of file
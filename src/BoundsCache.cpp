@@ -0,0 +1,121 @@
+/* This file is part of Jutchs Shmup.
+
+Jutchs Shmup is free software: you can redistribute it and/or modify it
+under the terms of the GNU General Public License as published by the Free Software Foundation,
+either version 3 of the License, or (at your option) any later version.
+
+Jutchs Shmup is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with Jutchs Shmup.
+If not, see <https://www.gnu.org/licenses/>. */
+
+#include "BoundsCache.h"
+
+#include "geometry.h"
+
+#include <algorithm>
+#include <limits>
+
+#if defined(__AVX__)
+    #define BOUNDS_CACHE_AVX
+    #include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define BOUNDS_CACHE_SSE2
+    #include <emmintrin.h>
+#endif
+
+namespace {
+    // NaN compares false with everything so these bounds never intersect
+    const float NO_BOUNDS = std::numeric_limits<float>::quiet_NaN();
+}
+
+void BoundsCache::clear() noexcept {
+    m_left  .assign(BLOCK_SIZE, NO_BOUNDS);
+    m_top   .assign(BLOCK_SIZE, NO_BOUNDS);
+    m_right .assign(BLOCK_SIZE, NO_BOUNDS);
+    m_bottom.assign(BLOCK_SIZE, NO_BOUNDS);
+    m_size = 0;
+}
+
+void BoundsCache::sync(const std::vector<std::unique_ptr<Entity>>& entities) {
+    for (int i = m_size; i < std::ssize(entities); ++ i) {
+        if (entities[i]->shouldBeDeleted())
+            pushEmpty();
+        else
+            push(sweep(entities[i]->getGlobalBounds(), -entities[i]->getLastMovement()));
+    }
+}
+
+void BoundsCache::push(sf::FloatRect bounds) noexcept {
+    // sf::Rect size may be negative
+    m_left  [m_size] = std::min(left(bounds), right(bounds));
+    m_right [m_size] = std::max(left(bounds), right(bounds));
+    m_top   [m_size] = std::min(top(bounds), bottom(bounds));
+    m_bottom[m_size] = std::max(top(bounds), bottom(bounds));
+    ++ m_size;
+
+    m_left  .push_back(NO_BOUNDS);
+    m_top   .push_back(NO_BOUNDS);
+    m_right .push_back(NO_BOUNDS);
+    m_bottom.push_back(NO_BOUNDS);
+}
+
+void BoundsCache::pushEmpty() noexcept {
+    ++ m_size;
+
+    m_left  .push_back(NO_BOUNDS);
+    m_top   .push_back(NO_BOUNDS);
+    m_right .push_back(NO_BOUNDS);
+    m_bottom.push_back(NO_BOUNDS);
+}
+
+uint32_t BoundsCache::intersectMask(sf::FloatRect bounds, int j) const noexcept {
+    return intersectMask(std::min(left(bounds), right(bounds)), std::min(top(bounds), bottom(bounds)), 
+                         std::max(left(bounds), right(bounds)), std::max(top(bounds), bottom(bounds)), j);
+}
+
+uint32_t BoundsCache::intersectMask(float boundsLeft, float boundsTop, 
+                                    float boundsRight, float boundsBottom, int j) const noexcept {
+#if defined(BOUNDS_CACHE_AVX)
+    __m256 left   = _mm256_set1_ps(boundsLeft  );
+    __m256 top    = _mm256_set1_ps(boundsTop   );
+    __m256 right  = _mm256_set1_ps(boundsRight );
+    __m256 bottom = _mm256_set1_ps(boundsBottom);
+
+    __m256 horizontal = _mm256_and_ps(
+        _mm256_cmp_ps(left, _mm256_loadu_ps(&m_right[j]), _CMP_LT_OQ),
+        _mm256_cmp_ps(_mm256_loadu_ps(&m_left[j]), right, _CMP_LT_OQ));
+    __m256 vertical = _mm256_and_ps(
+        _mm256_cmp_ps(top, _mm256_loadu_ps(&m_bottom[j]), _CMP_LT_OQ),
+        _mm256_cmp_ps(_mm256_loadu_ps(&m_top[j]), bottom, _CMP_LT_OQ));
+
+    return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_and_ps(horizontal, vertical)));
+#elif defined(BOUNDS_CACHE_SSE2)
+    __m128 left   = _mm_set1_ps(boundsLeft  );
+    __m128 top    = _mm_set1_ps(boundsTop   );
+    __m128 right  = _mm_set1_ps(boundsRight );
+    __m128 bottom = _mm_set1_ps(boundsBottom);
+
+    uint32_t mask = 0;
+    for (int k = 0; k < BLOCK_SIZE; k += 4) {
+        __m128 horizontal = _mm_and_ps(
+            _mm_cmplt_ps(left, _mm_loadu_ps(&m_right[j + k])),
+            _mm_cmplt_ps(_mm_loadu_ps(&m_left[j + k]), right));
+        __m128 vertical = _mm_and_ps(
+            _mm_cmplt_ps(top, _mm_loadu_ps(&m_bottom[j + k])),
+            _mm_cmplt_ps(_mm_loadu_ps(&m_top[j + k]), bottom));
+
+        mask |= static_cast<uint32_t>(_mm_movemask_ps(_mm_and_ps(horizontal, vertical))) << k;
+    }
+    return mask;
+#else
+    uint32_t mask = 0;
+    for (int k = 0; k < BLOCK_SIZE; ++ k)
+        if (intersects(boundsLeft, boundsRight , m_left[j + k], m_right [j + k])
+         && intersects(boundsTop , boundsBottom, m_top [j + k], m_bottom[j + k]))
+            mask |= 1u << k;
+    return mask;
+#endif
+}
\ No newline at end of file
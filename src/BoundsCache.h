@@ -0,0 +1,75 @@
+/* This file is part of Jutchs Shmup.
+
+Jutchs Shmup is free software: you can redistribute it and/or modify it
+under the terms of the GNU General Public License as published by the Free Software Foundation,
+either version 3 of the License, or (at your option) any later version.
+
+Jutchs Shmup is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with Jutchs Shmup.
+If not, see <https://www.gnu.org/licenses/>. */
+
+#ifndef BOUNDS_CACHE_H_
+#define BOUNDS_CACHE_H_
+
+#include "Entity.h"
+
+#include <SFML/Graphics.hpp>
+
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+// global bounds of entities stored as structure of arrays
+// filled once per tick so collision checks don't recompute sprite transforms
+class BoundsCache {
+public:
+    // number of bounds tested by one intersectMask call
+    static const constexpr int BLOCK_SIZE = 8;
+
+    BoundsCache() noexcept : m_size{0} {
+        clear();
+    }
+
+    void clear() noexcept;
+
+    // cache bounds of entities that aren't cached yet
+    // bounds are swept back along the last movement of entities
+    // entities that should be deleted get bounds that never intersect anything
+    void sync(const std::vector<std::unique_ptr<Entity>>& entities);
+
+    void push(sf::FloatRect bounds) noexcept;
+    void pushEmpty() noexcept;
+
+    // bit k is set if bounds i intersect bounds j + k (strictly)
+    // bits for indices past size() are never set
+    uint32_t intersectMask(int i, int j) const noexcept {
+        return intersectMask(m_left[i], m_top[i], m_right[i], m_bottom[i], j);
+    }
+
+    // the same for bounds not in the cache
+    uint32_t intersectMask(sf::FloatRect bounds, int j) const noexcept;
+
+    sf::FloatRect getBounds(int i) const noexcept {
+        return {m_left[i], m_top[i], m_right[i] - m_left[i], m_bottom[i] - m_top[i]};
+    }
+
+    int size() const noexcept {
+        return m_size;
+    }
+private:
+    // each array has BLOCK_SIZE never intersecting bounds after the last element
+    // so a block can be loaded starting from any valid index
+    std::vector<float> m_left;
+    std::vector<float> m_top;
+    std::vector<float> m_right;
+    std::vector<float> m_bottom;
+
+    int m_size;
+
+    uint32_t intersectMask(float left, float top, float right, float bottom, int j) const noexcept;
+};
+
+#endif
\ No newline at end of file
@@ -19,8 +19,7 @@ If not, see <https://www.gnu.org/licenses/>. */
 #include <SFML/System.hpp>
 
 Bullet::Bullet(GameState& gameState, bool playerSide, sf::Vector2f position) :
-        Sprite{gameState}, m_playerSide{playerSide}, m_alive{true}, 
-        m_liveTimer{gameState} {
+        Sprite{gameState}, m_playerSide{playerSide}, m_lastMovement{0.f, 0.f}, m_alive{true} {
     auto& texture = gameState.getAssets().getBulletTexture();
     setTexture(texture);
 
@@ -36,8 +35,10 @@ void Bullet::acceptCollide(Airplane::Airplane& other) noexcept {
         m_alive = false;
 }
 
+void Bullet::handleAdded() {
+    m_gameState.getTimers().schedule(sf::seconds(2.0f), {getId(), EXPIRE_TIMER});
+}
+
 bool Bullet::shouldBeDeleted() const noexcept {
-    return !(m_alive 
-             && m_gameState.inActiveArea(getPosition().x) 
-             && m_liveTimer.getPassedTime() <= sf::seconds(2.0f));
+    return !(m_alive && m_gameState.inActiveArea(getPosition().x));
 }
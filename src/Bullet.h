@@ -34,7 +34,22 @@ public:
     }
 
     void update(sf::Time elapsedTime) noexcept override {
-        move((m_playerSide ? 1 : -1) * 750.f * elapsedTime.asSeconds(), 0);
+        m_lastMovement = {(m_playerSide ? 1 : -1) * 750.f * elapsedTime.asSeconds(), 0.f};
+        move(m_lastMovement);
+    }
+
+    sf::Vector2f getLastMovement() const noexcept override {
+        return m_lastMovement;
+    }
+
+    bool isUpdatedInParallel() const noexcept override {
+        return true;
+    }
+
+    void handleAdded() override;
+
+    void handleTimer(int) noexcept override {
+        m_alive = false;
     }
 
     void acceptCollide(Airplane::Airplane& other) noexcept override;
@@ -48,11 +63,17 @@ public:
     bool isOnPlayerSide() const noexcept {
         return m_playerSide;
     }
+
+    std::unique_ptr<Entity> clone() const override {
+        return std::make_unique<Bullet>(*this);
+    }
 private:
     bool m_playerSide;
+    sf::Vector2f m_lastMovement;
 
     bool m_alive;
-    PassedTimer m_liveTimer;
+
+    static const constexpr int EXPIRE_TIMER = 0;
 };
 
 #endif
\ No newline at end of file
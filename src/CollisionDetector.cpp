@@ -0,0 +1,59 @@
+/* This file is part of Jutchs Shmup.
+
+Jutchs Shmup is free software: you can redistribute it and/or modify it 
+under the terms of the GNU General Public License as published by the Free Software Foundation, 
+either version 3 of the License, or (at your option) any later version.
+
+Jutchs Shmup is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with Jutchs Shmup. 
+If not, see <https://www.gnu.org/licenses/>. */
+
+#include "CollisionDetector.h"
+
+#include <algorithm>
+#include <bit>
+
+const int MIN_BOUNDS_PER_COLLISION_THREAD = 64;
+
+void CollisionDetector::setThreadCount(int threadCount) {
+    m_workers = std::make_unique<WorkerPool>(threadCount);
+    m_threadPairs.resize(m_workers->getThreadCount());
+}
+
+int CollisionDetector::getThreadCountFor(int boundsCount) const noexcept {
+    return std::clamp(boundsCount / MIN_BOUNDS_PER_COLLISION_THREAD, 1, getThreadCount());
+}
+
+const std::vector<CollisionDetector::Pair>& CollisionDetector::findPairs(const BoundsCache& bounds) {
+    int threads = getThreadCountFor(bounds.size());
+
+    // rows get shorter with i so they are interleaved between threads to balance work
+    auto findThreadPairs = [&bounds, threads, this](int thread) {
+        m_threadPairs[thread].clear();
+        if (thread < threads) 
+            findPairs(bounds, thread, threads, m_threadPairs[thread]);
+    };
+
+    if (threads == 1)
+        findThreadPairs(0);
+    else
+        m_workers->run(findThreadPairs);
+
+    m_pairs.clear();
+    for (int thread = 0; thread < threads; ++ thread)
+        m_pairs.insert(m_pairs.end(), m_threadPairs[thread].begin(), m_threadPairs[thread].end());
+    std::ranges::sort(m_pairs);
+
+    return m_pairs;
+}
+
+void CollisionDetector::findPairs(const BoundsCache& bounds, int first, int step, 
+                                  std::vector<Pair>& pairs) {
+    for (int i = first; i < bounds.size(); i += step)
+        for (int j = i + 1; j < bounds.size(); j += BoundsCache::BLOCK_SIZE)
+            for (uint32_t mask = bounds.intersectMask(i, j); mask; mask &= mask - 1)
+                pairs.push_back({i, j + std::countr_zero(mask)});
+}
@@ -0,0 +1,58 @@
+/* This file is part of Jutchs Shmup.
+
+Jutchs Shmup is free software: you can redistribute it and/or modify it 
+under the terms of the GNU General Public License as published by the Free Software Foundation, 
+either version 3 of the License, or (at your option) any later version.
+
+Jutchs Shmup is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with Jutchs Shmup. 
+If not, see <https://www.gnu.org/licenses/>. */
+
+#ifndef COLLISION_DETECTOR_H_
+#define COLLISION_DETECTOR_H_
+
+#include "BoundsCache.h"
+#include "WorkerPool.h"
+
+#include <vector>
+#include <memory>
+
+// finds intersecting bounds on worker threads
+// collision handlers change entities so pairs are dispatched by the caller on one thread
+class CollisionDetector {
+public:
+    struct Pair {
+        int first;
+        int second; // always greater than first
+
+        friend auto operator <=> (const Pair&, const Pair&) = default;
+    };
+
+    explicit CollisionDetector(int threadCount = 1) {
+        setThreadCount(threadCount);
+    }
+
+    void setThreadCount(int threadCount);
+
+    int getThreadCount() const noexcept {
+        return m_workers->getThreadCount();
+    }
+
+    // threads findPairs uses, fewer bounds are checked by the calling thread alone
+    int getThreadCountFor(int boundsCount) const noexcept;
+
+    // pairs sorted by first then by second, the same for any thread count
+    // valid until the next call
+    const std::vector<Pair>& findPairs(const BoundsCache& bounds);
+private:
+    std::unique_ptr<WorkerPool> m_workers;
+    std::vector<std::vector<Pair>> m_threadPairs;
+    std::vector<Pair> m_pairs;
+
+    static void findPairs(const BoundsCache& bounds, int first, int step, std::vector<Pair>& pairs);
+};
+
+#endif
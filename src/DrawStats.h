@@ -0,0 +1,23 @@
+/* This file is part of Jutchs Shmup.
+
+Jutchs Shmup is free software: you can redistribute it and/or modify it 
+under the terms of the GNU General Public License as published by the Free Software Foundation, 
+either version 3 of the License, or (at your option) any later version.
+
+Jutchs Shmup is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with Jutchs Shmup. 
+If not, see <https://www.gnu.org/licenses/>. */
+
+#ifndef DRAW_STATS_H_
+#define DRAW_STATS_H_
+
+// objects drawn and skipped as invisible by the last draw
+struct DrawStats {
+    int drawn;
+    int culled;
+};
+
+#endif
@@ -21,17 +21,61 @@ If not, see <https://www.gnu.org/licenses/>. */
 #include <SFML/System.hpp>
 
 #include <concepts>
+#include <memory>
+#include <cstdint>
 
 class Entity {
 public:
     virtual ~Entity() = default;
 
+    // unique among entities of EntityManager, kept by copies
+    // 0 until the entity is added to EntityManager
+    uint64_t getId() const noexcept {
+        return m_id;
+    }
+
+    // called once when the entity is added to EntityManager, timers can be scheduled from here
+    virtual void handleAdded() {}
+
+    // called when a timer scheduled for this entity on GameState timers fires
+    virtual void handleTimer(int type) {}
+
     virtual void handleEvent(sf::Event event) {}
 
     virtual void update(sf::Time elapsedTime) = 0;
 
+    // update of entities far from the player
+    // straight movement without AI or shooting, must be as safe to run in parallel as update
+    virtual void coast(sf::Time elapsedTime) {
+        update(elapsedTime);
+    }
+
+    // entities returning true are updated by worker threads with updateDeferred
+    // it may change only the entity itself and posts everything else to commands
+    virtual bool isUpdatedInParallel() const noexcept {
+        return false;
+    }
+
+    virtual void updateDeferred(sf::Time elapsedTime, UpdateCommands& commands) {
+        update(elapsedTime);
+    }
+
     virtual sf::FloatRect getGlobalBounds() const noexcept = 0;
 
+    // called before every simulation step
+    virtual void savePosition() noexcept {}
+
+    // movement since savePosition, drawing interpolates along it
+    virtual sf::Vector2f getStepMovement() const noexcept {
+        return {0.f, 0.f};
+    }
+
+    // movement during the last update
+    // fast entities return it so collisions along the way aren't missed
+    virtual sf::Vector2f getLastMovement() const noexcept {
+        return {0.f, 0.f};
+    }
+
     virtual void startCollide(Entity& other) = 0;   
     virtual void acceptCollide(Airplane::Airplane& other) {}
     virtual void acceptCollide(Bullet& other) {}
@@ -52,6 +96,15 @@ public:
     virtual void handleBombExplosion(sf::Vector2f position, float radius) {}
 
     virtual bool shouldBeDeleted() const noexcept = 0;
+
+    // copy used by world snapshots
+    virtual std::unique_ptr<Entity> clone() const = 0;
+protected:
+    Entity() noexcept : m_id{0} {}
+private:
+    uint64_t m_id;
+
+    friend class EntityManager;
 };
 
 // CRTP
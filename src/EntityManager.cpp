@@ -24,47 +24,67 @@ If not, see <https://www.gnu.org/licenses/>. */
 #include "geometry.h"
 
 #include <array>
+#include <bit>
+#include <cassert>
+#include <algorithm>
 
 const int PLAYER_MAX_HEALTH = 3;
 const sf::Vector2f PLAYER_START_POSITION{0.f, 0.f};
 
-EntityManager::EntityManager(GameState& gameState) noexcept : 
+// more enemies are deferred to the next ticks
+const int MAX_ENEMY_SPAWNS_PER_TICK = 2;
+
+// interpolated positions lag behind the cached bounds a bit
+const float CULL_MARGIN = 16.f;
+
+// fewer entities are updated by the calling thread alone
+const int MIN_ENTITIES_PER_UPDATE_THREAD = 64;
+const int MAX_UPDATE_THREADS = 4;
+const int MAX_COLLISION_THREADS = 4;
+
+namespace {
+    // headless games are run in parallel by themselves
+    // mode of gameState is already initialized when EntityManager is constructed
+    int getThreadCountFor(const GameState& gameState, int maxThreadCount) noexcept {
+        return gameState.isHeadless() ? 1 : WorkerPool::getDefaultThreadCount(maxThreadCount);
+    }
+}
+
+EntityManager::EntityManager(GameState& gameState) : 
+    m_nextEntityId{1}, m_collisionDetector{getThreadCountFor(gameState, MAX_COLLISION_THREADS)}, 
     m_playerPosition{PLAYER_START_POSITION}, 
     m_playerGlobalBounds{PLAYER_START_POSITION.x, PLAYER_START_POSITION.y, 0.f, 0.f},
-    m_gameState{gameState} {}
+    m_drawStats{0, 0}, m_gameState{gameState} {
+    setUpdateThreadCount(getThreadCountFor(gameState, MAX_UPDATE_THREADS));
+}
+
+void EntityManager::setUpdateThreadCount(int threadCount) {
+    m_updateWorkers = std::make_unique<WorkerPool>(threadCount);
+    m_updateCommands.resize(m_updateWorkers->getThreadCount());
+}
 
 void EntityManager::init() {
     spawnPlayer();
     m_spawnX = 4 * m_gameState.getGameHeight();
 }
 
-namespace {
-    std::array<Airplane::ShootComponent::PatternElement, 1> basicPattern {
-        Airplane::ShootComponent::PatternElement{{0.f, 0.f}, sf::seconds(0.25f)}
-    };
-
-    std::array<Airplane::ShootComponent::PatternElement, 3> triplePattern {
-        Airplane::ShootComponent::PatternElement{{0.f,   0.f}, sf::seconds(0.0f)},
-        Airplane::ShootComponent::PatternElement{{0.f,  32.f}, sf::seconds(0.0f)},
-        Airplane::ShootComponent::PatternElement{{0.f, -32.f}, sf::seconds(0.5f)}
-    };
-
-    std::array<Airplane::ShootComponent::PatternElement, 3> volleyPattern {
-        Airplane::ShootComponent::PatternElement{{0.f, 0.f}, sf::seconds(0.1f)},
-        Airplane::ShootComponent::PatternElement{{0.f, 0.f}, sf::seconds(0.1f)},
-        Airplane::ShootComponent::PatternElement{{0.f, 0.f}, sf::seconds(0.5f)}
-    };
-}
-
 void EntityManager::spawnPlayer() {
     using enum Airplane::Flags;
 
-    m_player = Airplane::Builder{m_gameState}
-        .position(PLAYER_START_POSITION).maxHealth(PLAYER_MAX_HEALTH)
+    Airplane::Builder builder{m_gameState};
+    builder.position(PLAYER_START_POSITION).maxHealth(PLAYER_MAX_HEALTH)
         .flags(PLAYER_SIDE | HEAVY | SLOW | NO_WEAPON | USE_PICKUPS)
-        .shootPattern(basicPattern)
-        .shootControlComponent<Airplane::PlayerShootControlComponent>()
-        .moveComponent<Airplane::PlayerMoveComponent>().speed(250.f, 250.f)
+        .shootPattern(Airplane::getBasicShootPattern());
+
+    // nobody controls player in headless games
+    if (m_gameState.isHeadless())
+        builder.shootControlComponent<Airplane::AlwaysShootControlComponent>()
+               .moveComponent<Airplane::AutopilotMoveComponent>();
+    else
+        builder.shootControlComponent<Airplane::PlayerShootControlComponent>()
+               .moveComponent<Airplane::PlayerMoveComponent>();
+
+    m_player = builder.speed(250.f, 250.f)
         .bombComponent<Airplane::PlayerBombComponent>()
         .addDeathEffect<Airplane::LoseDeathEffect>()
         .addDeathEffect<Airplane::ExplosionDeathEffect>()
@@ -83,6 +103,11 @@ sf::FloatRect EntityManager::getPlayerGlobalBounds() const noexcept {
     return m_playerGlobalBounds;
 }
 
+sf::Vector2f EntityManager::getInterpolatedPlayerPosition() const noexcept {
+    if (!m_player) return m_playerPosition;
+    return m_playerPosition - (1.f - m_gameState.getInterpolation()) * m_player->getStepMovement();
+}
+
 int EntityManager::getPlayerHealth() const noexcept {
     return m_player ? m_player->getHealth() : 0;
 }
@@ -94,24 +119,80 @@ void EntityManager::handleEvent(sf::Event event) noexcept {
     }
 }
 
+int EntityManager::updateInParallel(sf::Time elapsedTime) {
+    int count = static_cast<int>(ssize(m_entities));
+    int chunks = std::clamp(count / MIN_ENTITIES_PER_UPDATE_THREAD, 1, getUpdateThreadCount());
+
+    auto updateChunk = [this, elapsedTime, count, chunks](int chunk) {
+        if (chunk >= chunks) return;
+
+        for (int i = count * chunk / chunks; i < count * (chunk + 1) / chunks; ++ i)
+            if (m_entities[i]->isUpdatedInParallel() && !m_entities[i]->shouldBeDeleted()) {
+                if (isNear(i))
+                    m_entities[i]->updateDeferred(elapsedTime, m_updateCommands[chunk]);
+                else
+                    m_entities[i]->coast(elapsedTime);
+            }
+    };
+
+    if (chunks == 1)
+        updateChunk(0);
+    else
+        m_updateWorkers->run(updateChunk);
+
+    // chunks are contiguous so commands are applied in entity order for any chunk count
+    for (int chunk = 0; chunk < chunks; ++ chunk)
+        m_updateCommands[chunk].apply(m_gameState);
+
+    return count;
+}
+
 void EntityManager::update(sf::Time elapsedTime) noexcept {
-    for (int i = 0; i < ssize(m_entities); ++ i) 
-        if (!m_entities[i]->shouldBeDeleted()) 
-            m_entities[i]->update(elapsedTime);
+    for (auto& entity : m_entities)
+        entity->savePosition();
+
+    int updatedInParallel = updateInParallel(elapsedTime);
+
+    // entities added since are updated here whatever they are
+    for (int i = 0; i < ssize(m_entities); ++ i) {
+        if ((i >= updatedInParallel || !m_entities[i]->isUpdatedInParallel())
+                && !m_entities[i]->shouldBeDeleted()) {
+            if (isNear(i))
+                m_entities[i]->update(elapsedTime);
+            else
+                m_entities[i]->coast(elapsedTime);
+        }
+    }
 
     if (m_player) {
         m_playerPosition = m_player->getPosition();
         m_playerGlobalBounds = m_player->getGlobalBounds();
     }
     
-    for (int i = 0; i < ssize(m_entities); ++ i) 
-        for (int j = i + 1; j < ssize(m_entities); ++ j) 
-            if (!m_entities[i]->shouldBeDeleted() 
-             && !m_entities[j]->shouldBeDeleted() 
-             && intersects(m_entities[i]->getGlobalBounds(), 
-                           m_entities[j]->getGlobalBounds())) {
-                m_entities[i]->startCollide(*m_entities[j]);
-                m_entities[j]->startCollide(*m_entities[i]);
+    // entities don't move while colliding so bounds are computed once
+    m_bounds.clear();
+    m_bounds.sync(m_entities);
+
+    int detected = m_bounds.size();
+    for (auto [i, j] : m_collisionDetector.findPairs(m_bounds)) {
+        if (!m_entities[i]->shouldBeDeleted() && !m_entities[j]->shouldBeDeleted() 
+                && collides(*m_entities[i], *m_entities[j]))
+            collide(*m_entities[i], *m_entities[j]);
+    }
+
+    // entities added by collision handlers are cached when they appear and checked here
+    for (int i = 0; i < ssize(m_entities); ++ i) {
+        if (m_entities[i]->shouldBeDeleted()) continue;
+
+        for (int j = std::max(i + 1, detected); j < ssize(m_entities); j += BoundsCache::BLOCK_SIZE) {
+            m_bounds.sync(m_entities);
+            for (uint32_t mask = m_bounds.intersectMask(i, j); mask; mask &= mask - 1) {
+                int other = j + std::countr_zero(mask);
+                if (!m_entities[i]->shouldBeDeleted() && !m_entities[other]->shouldBeDeleted()
+                        && collides(*m_entities[i], *m_entities[other]))
+                    collide(*m_entities[i], *m_entities[other]);
+            }
+        }
     }
 
     if (m_player && m_player->shouldBeDeleted()) {
@@ -122,115 +203,184 @@ void EntityManager::update(sf::Time elapsedTime) noexcept {
     }
 
     erase_if(m_entities, [this](const std::unique_ptr<Entity>& entity) -> bool {
-        return entity->shouldBeDeleted();
+        if (!entity->shouldBeDeleted()) return false;
+
+        m_entitiesById.erase(entity->getId());
+        return true;
     });
 
     checkEnemySpawn();
+
+    m_bounds.clear();
+    m_bounds.sync(m_entities);
+}
+
+bool EntityManager::isNear(int i) const noexcept {
+    return i >= m_bounds.size() || m_gameState.inNearArea(m_bounds.getBounds(i));
+}
+
+bool EntityManager::collides(const Entity& lhs, const Entity& rhs) noexcept {
+    // cached bounds are exact for entities that don't report movement
+    if (lhs.getLastMovement() == sf::Vector2f{} && rhs.getLastMovement() == sf::Vector2f{})
+        return true;
+
+    return sweptIntersects(lhs.getGlobalBounds(), lhs.getLastMovement() - rhs.getLastMovement(), 
+                           rhs.getGlobalBounds());
 }
 
 void EntityManager::draw(sf::RenderTarget& target, sf::RenderStates states) const noexcept {
-    for (const auto& entity : m_entities)
-        if (!entity->shouldBeDeleted()) 
-            entity->drawLand(target, states);
+    sf::View view = target.getView();
+    sf::FloatRect viewBounds{view.getCenter() - view.getSize() / 2.f, view.getSize()};
+    viewBounds.left -= CULL_MARGIN;
+    viewBounds.top  -= CULL_MARGIN;
+    viewBounds.width  += 2 * CULL_MARGIN;
+    viewBounds.height += 2 * CULL_MARGIN;
+
+    m_visibleMasks.clear();
+    for (int j = 0; j < m_bounds.size(); j += BoundsCache::BLOCK_SIZE)
+        m_visibleMasks.push_back(m_bounds.intersectMask(viewBounds, j));
+
+    // entities added after the last update have no cached bounds and are always drawn
+    auto isVisible = [this](int i) {
+        if (i >= m_bounds.size()) return true;
+        return static_cast<bool>(m_visibleMasks[i / BoundsCache::BLOCK_SIZE] 
+                                 & (1u << (i % BoundsCache::BLOCK_SIZE)));
+    };
 
-    for (const auto& entity : m_entities)
-        if (!entity->shouldBeDeleted()) 
-            entity->drawAir(target, states);
+    m_drawStats = {0, 0};
+    for (int i = 0; i < ssize(m_entities); ++ i)
+        if (!m_entities[i]->shouldBeDeleted())
+            ++ (isVisible(i) ? m_drawStats.drawn : m_drawStats.culled);
+
+    // entities are drawn between their previous and current step positions
+    float interpolation = m_gameState.getInterpolation();
+    auto interpolated = [states, interpolation](const Entity& entity) {
+        sf::RenderStates entityStates = states;
+        entityStates.transform.translate((interpolation - 1.f) * entity.getStepMovement());
+        return entityStates;
+    };
+
+    for (int i = 0; i < ssize(m_entities); ++ i)
+        if (!m_entities[i]->shouldBeDeleted() && isVisible(i)) 
+            m_entities[i]->drawLand(target, interpolated(*m_entities[i]));
+
+    for (int i = 0; i < ssize(m_entities); ++ i)
+        if (!m_entities[i]->shouldBeDeleted() && isVisible(i)) 
+            m_entities[i]->drawAir(target, interpolated(*m_entities[i]));
 }
 
 void EntityManager::reset() noexcept {
     m_entities.clear();
+    m_entitiesById.clear();
+    m_bounds.clear();
+    m_pendingSpawns.clear();
     spawnPlayer();
     m_spawnX = 4 * m_gameState.getGameHeight();
 }
 
+EntityManager::Snapshot EntityManager::getSnapshot() const {
+    Snapshot snapshot{{}, -1, m_nextEntityId, m_playerPosition, m_playerGlobalBounds, m_spawnX, m_pendingSpawns};
+    
+    snapshot.entities.reserve(m_entities.size());
+    for (const auto& entity : m_entities) {
+        if (entity.get() == m_player)
+            snapshot.playerIndex = static_cast<int>(std::ssize(snapshot.entities));
+        snapshot.entities.push_back(entity->clone());
+    }
+
+    return snapshot;
+}
+
+void EntityManager::restore(const Snapshot& snapshot) {
+    m_entities.clear();
+    m_entitiesById.clear();
+    m_bounds.clear();
+    m_entities.reserve(snapshot.entities.size());
+    for (const auto& entity : snapshot.entities) {
+        m_entities.push_back(entity->clone());
+        assert(m_entities.back()->getId() == entity->getId() && "clone must keep entity id");
+        m_entitiesById.emplace(m_entities.back()->getId(), m_entities.back().get());
+    }
+    m_nextEntityId = snapshot.nextEntityId;
+
+    m_player = nullptr;
+    if (snapshot.playerIndex >= 0)
+        m_player = dynamic_cast<Airplane::Airplane*>(m_entities[snapshot.playerIndex].get());
+
+    m_playerPosition = snapshot.playerPosition;
+    m_playerGlobalBounds = snapshot.playerGlobalBounds;
+    m_spawnX = snapshot.spawnX;
+    m_pendingSpawns = snapshot.pendingSpawns;
+}
+
 void EntityManager::handleBombExplosion(sf::Vector2f position, float radius) {
     for (auto& entity : m_entities)
         entity->handleBombExplosion(position, radius);
 }
 
+void EntityManager::handleTimer(TimerWheel::Event event) {
+    auto entity = m_entitiesById.find(event.entityId);
+    if (entity != m_entitiesById.end() && !entity->second->shouldBeDeleted())
+        entity->second->handleTimer(event.type);
+}
+
 void EntityManager::checkEnemySpawn() {
     while (getPlayerPosition().x + 4 * m_gameState.getGameHeight() > m_spawnX) {
         sf::Vector2u enemySize = m_gameState.getAssets().getAirplaneTextureSize();
         for (float y = (enemySize.y - m_gameState.getGameHeight()) / 2; 
                 y < (m_gameState.getGameHeight() - enemySize.y) / 2; y += enemySize.y) {
             if (std::uniform_real_distribution{0.0, 1.0}(m_gameState.getRandomEngine()) < 0.01)
-                spawnEnemy(sf::Vector2f{m_spawnX, y});
+                m_pendingSpawns.emplace_back(m_spawnX, y);
         }
         m_spawnX += enemySize.x;
     }
+
+    // pending spawns are sorted by x so the closest are spawned first
+    for (int spawned = 0; spawned < MAX_ENEMY_SPAWNS_PER_TICK && !m_pendingSpawns.empty(); ++ spawned) {
+        spawnEnemy(m_pendingSpawns.front());
+        m_pendingSpawns.pop_front();
+    }
 }
 
 void EntityManager::spawnEnemy(sf::Vector2f position) {
-    using enum Airplane::Flags;
+    using Archetype = Airplane::Archetype;
 
-    std::uniform_real_distribution canonicalDistribution{0.0, 1.0};
+    const Archetype& archetype = m_enemyArchetypes.getRandom(m_gameState.getRandomEngine());
 
     Airplane::Builder builder{m_gameState};
-    builder.position(position).maxHealth(1).flags(ENEMY_SIDE | NO_PICKUPS);
-
-    int score = 10;
+    builder.position(position).maxHealth(archetype.maxHealth).flags(archetype.flags)
+           .shootPattern(archetype.shootPattern).speed(archetype.speed).bomb(archetype.hasBomb)
+           .bombComponent<Airplane::EnemyBombComponent>();
 
-    if (canonicalDistribution(m_gameState.getRandomEngine()) < 0.1) {
-        builder.maxHealth(3);
-        builder.flags() |= HEAVY;
-        score *= 2;
-    } else {
-        builder.maxHealth(1);
-        builder.flags() |= LIGHT;
-    }
-
-    double shootSeed = canonicalDistribution(m_gameState.getRandomEngine());
-    bool advancedWeapon = false;
-    if (shootSeed < 0.1) {
-        builder.shootPattern(triplePattern);
-        builder.flags() |= HAS_WEAPON;
-        advancedWeapon = true;
-    } else if (shootSeed < 0.2) {
-        builder.shootPattern(volleyPattern);
-        builder.flags() |= NO_WEAPON;
-        advancedWeapon = true;
-    } else {
-        builder.shootPattern(basicPattern);
-        builder.flags() |= NO_WEAPON;
-    }
-
-    double shootControlSeed = canonicalDistribution(m_gameState.getRandomEngine());
-    if (shootControlSeed < 0.1) {
+    switch (archetype.shootControl) {
+    case Archetype::ShootControl::TARGET_PLAYER: {
         auto targetPlayer = builder.createComponent<Airplane::TargetPlayerShootControlComponent>();
         auto canHitPlayer = builder.createComponent<Airplane::CanHitPlayerShootControlComponent>();
         builder.shootControlComponent(targetPlayer && canHitPlayer);
-    } else if (shootControlSeed < 0.2) {
-        builder.shootControlComponent<Airplane::NeverShootControlComponent>();
-
-        builder.flags() &= ~HAS_WEAPON;
-        builder.flags() |= NO_WEAPON;
-        advancedWeapon = false;
-        score /= 2;
-    } else {
-        builder.shootControlComponent<Airplane::CanHitPlayerShootControlComponent>();
+        break;
     }
-
-    if (advancedWeapon) score *= 2;
-
-    if (canonicalDistribution(m_gameState.getRandomEngine()) < 0.1) {
-        builder.speed(500.f, 250.f);
-        builder.flags() |= FAST;
-        score *= 2;
-    } else {
-        builder.speed(250.f, 250.f);
-        builder.flags() |= SLOW;
-    }
-
-    bool hasBomb = false;
-    if (canonicalDistribution(m_gameState.getRandomEngine()) < 0.1) {
-        builder.bomb();
-        hasBomb = true;
-        score *= 2;
+    case Archetype::ShootControl::CAN_HIT_PLAYER:
+        builder.shootControlComponent<Airplane::CanHitPlayerShootControlComponent>();
+        break;
+    case Archetype::ShootControl::NEVER:
+        builder.shootControlComponent<Airplane::NeverShootControlComponent>();
+        break;
     }
-    builder.bombComponent<Airplane::EnemyBombComponent>();
 
-    if (hasBomb && canonicalDistribution(m_gameState.getRandomEngine()) < 0.9) {
+    switch (archetype.move) {
+    case Archetype::Move::BASIC:
+        builder.moveComponent<Airplane::BasicMoveComponent>();
+        break;
+    case Archetype::Move::PERIODICAL:
+        builder.moveComponent<Airplane::PeriodicalMoveComponent>();
+        break;
+    case Archetype::Move::TARGET_PLAYER:
+        builder.moveComponent(Airplane::createLineWithTargetMoveComponent,
+            [this](const Airplane::Airplane&) -> sf::Vector2f {
+                return getPlayerPosition();
+            });
+        break;
+    case Archetype::Move::TARGET_LAND:
         builder.moveComponent(Airplane::createLineWithTargetMoveComponent,
             [&land = m_gameState.getLand(), 
              target = m_gameState.getLand().getTargetFor(position)] 
@@ -240,21 +390,10 @@ void EntityManager::spawnEnemy(sf::Vector2f position) {
                 
                 return target;
             });
-    } else {
-        double moveSeed = canonicalDistribution(m_gameState.getRandomEngine());
-        if (moveSeed < 0.1) {
-            builder.moveComponent<Airplane::PeriodicalMoveComponent>();
-        } else if (moveSeed < 0.2) {
-            builder.moveComponent(Airplane::createLineWithTargetMoveComponent,
-                [this](const Airplane::Airplane&) -> sf::Vector2f {
-                    return getPlayerPosition();
-                });
-        } else {
-            builder.moveComponent<Airplane::BasicMoveComponent>();
-        }
+        break;
     }
 
-    builder.addDeathEffect<Airplane::ScoreDeathEffect>(score)
+    builder.addDeathEffect<Airplane::ScoreDeathEffect>(archetype.score)
            .addDeathEffect<Airplane::LootDeathEffect>()
            .addDeathEffect<Airplane::ExplosionDeathEffect>();
 
@@ -15,32 +15,46 @@ If not, see <https://www.gnu.org/licenses/>. */
 #define ENTITY_MANAGER_H_
 
 #include "Entity.h"
+#include "BoundsCache.h"
+#include "CollisionDetector.h"
+#include "UpdateCommands.h"
+#include "WorkerPool.h"
+#include "DrawStats.h"
+
+#include "Airplane/Archetypes.h"
 
 #include "declarations.h"
 
+#include "Timer.h"
+
 #include "functional.h"
 
 #include <algorithm>
 #include <ranges>
 #include <vector>
+#include <deque>
+#include <unordered_map>
 #include <memory>
 #include <concepts>
 
 class EntityManager : public sf::Drawable {
 public:
-    EntityManager(GameState& gameState) noexcept;
+    EntityManager(GameState& gameState);
 
     void addEntity(Entity* entity) {
-        m_entities.emplace_back(entity);
+        addEntity(std::unique_ptr<Entity>{entity});
     }
 
     void addEntity(std::unique_ptr<Entity>&& entity) {
+        entity->m_id = m_nextEntityId++;
+        m_entitiesById.emplace(entity->m_id, entity.get());
         m_entities.push_back(std::move(entity));
+        m_entities.back()->handleAdded();
     }
 
     template <std::derived_from<Entity> EntityT, typename... Args>
     void addEntity(Args&&... args) {
-        m_entities.push_back(createEntity<EntityT>(std::forward<Args>(args)...));
+        addEntity(createEntity<EntityT>(std::forward<Args>(args)...));
     }
 
     template <std::derived_from<Entity> EntityT, typename... Args> 
@@ -66,6 +80,8 @@ public:
     }
 
     sf::Vector2f getPlayerPosition() const noexcept;
+    // between the previous and the current step as drawn
+    sf::Vector2f getInterpolatedPlayerPosition() const noexcept;
     sf::FloatRect getPlayerGlobalBounds() const noexcept;
     int getPlayerHealth() const noexcept;
     
@@ -73,10 +89,31 @@ public:
 
     void handleEvent(sf::Event event) noexcept;
 
+    // single simulation step
     void update(sf::Time elapsedTime) noexcept;
 
+    // 1 updates everything on the game thread
+    // result is the same for any thread count
+    void setUpdateThreadCount(int threadCount);
+
+    int getUpdateThreadCount() const noexcept {
+        return m_updateWorkers->getThreadCount();
+    }
+
+    // threads looking for collisions, handlers always run on the game thread
+    void setCollisionThreadCount(int threadCount) {
+        m_collisionDetector.setThreadCount(threadCount);
+    }
+
+    int getCollisionThreadCount() const noexcept {
+        return m_collisionDetector.getThreadCount();
+    }
+
     void handleBombExplosion(sf::Vector2f position, float radius);
 
+    // timers of deleted entities are ignored
+    void handleTimer(TimerWheel::Event event);
+
     bool trySpawnTurret(sf::Vector2f position);
 
     bool trySpawnTurret(float x, float y) {
@@ -85,18 +122,66 @@ public:
 
     void reset() noexcept;
 
+    struct Snapshot {
+        std::vector<std::unique_ptr<Entity>> entities;
+        int playerIndex; // -1 if there is no player
+        uint64_t nextEntityId;
+        sf::Vector2f playerPosition;
+        sf::FloatRect playerGlobalBounds;
+        float spawnX;
+        std::deque<sf::Vector2f> pendingSpawns;
+    };
+
+    Snapshot getSnapshot() const;
+    void restore(const Snapshot& snapshot);
+
+    // entities outside of the view are culled
     void draw(sf::RenderTarget& target, sf::RenderStates states) const noexcept override;
+
+    DrawStats getDrawStats() const noexcept {
+        return m_drawStats;
+    }
 private:
     std::vector<std::unique_ptr<Entity>> m_entities;
+    std::unordered_map<uint64_t, Entity*> m_entitiesById;
+    uint64_t m_nextEntityId;
+    // after update it holds bounds of all entities for culling
+    BoundsCache m_bounds;
+    CollisionDetector m_collisionDetector;
 
     Airplane::Airplane* m_player;
     sf::Vector2f m_playerPosition;
     sf::FloatRect m_playerGlobalBounds;
 
     float m_spawnX;
+    // positions of enemies waiting for spawn budget
+    std::deque<sf::Vector2f> m_pendingSpawns;
+    Airplane::ArchetypeTable m_enemyArchetypes;
+
+    std::unique_ptr<WorkerPool> m_updateWorkers;
+    // one per chunk of entities, applied in chunk order
+    std::vector<UpdateCommands> m_updateCommands;
+
+    // bit k of mask i is set if entity i * BLOCK_SIZE + k is visible
+    mutable std::vector<uint32_t> m_visibleMasks;
+    mutable DrawStats m_drawStats;
 
     GameState& m_gameState;
 
+    // update entities with isUpdatedInParallel, return number of entities considered
+    int updateInParallel(sf::Time elapsedTime);
+
+    // uses bounds cached by the last update, entities added since are near
+    bool isNear(int i) const noexcept;
+
+    // exact check for entities with intersecting cached bounds
+    static bool collides(const Entity& lhs, const Entity& rhs) noexcept;
+
+    static void collide(Entity& lhs, Entity& rhs) {
+        lhs.startCollide(rhs);
+        rhs.startCollide(lhs);
+    }
+
     void spawnPlayer();
 
     void checkEnemySpawn();
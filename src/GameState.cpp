@@ -13,15 +13,26 @@ If not, see <https://www.gnu.org/licenses/>. */
 
 #include "GameState.h"
 
+#include "geometry.h"
+
 #include <ranges>
 #include <algorithm>
 #include <utility>
 
-GameState::GameState(sf::Vector2f screenSize) : 
-        m_randomEngine{std::random_device{}()},
-        m_assetManager{m_randomEngine}, m_entityManager{*this}, m_landManager{*this},
+// bullets are swept so a low rate doesn't miss hits
+const sf::Time SIMULATION_STEP = sf::seconds(1.f / 30.f);
+// longer frames are simulated slowed down instead of spiraling
+const sf::Time MAX_SIMULATED_FRAME = SIMULATION_STEP * 5.f;
+
+GameState::GameState(sf::Vector2f screenSize, std::shared_ptr<const AssetManager> assets, 
+                     Mode mode, uint64_t seed) : 
+        m_mode{mode}, m_randomEngine{seed}, 
+        m_assetManager{std::move(assets)}, m_entityManager{*this}, m_landManager{*this}, 
+        m_soundManager{mode == Mode::INTERACTIVE}, 
         m_screenSize{screenSize}, m_gameHeight{512},
-        m_scoreManager{*this}, m_shouldEnd{false}, m_guiManager{*this} {
+        m_scoreManager{*this}, m_shouldEnd{false}, m_guiManager{*this}, 
+        m_timers{SIMULATION_STEP}, m_stepAccumulator{sf::Time::Zero}, m_interpolation{0.f}, 
+        m_currentTime{sf::Time::Zero}, m_rewindSnapshotDelay{sf::Time::Zero} {
     m_languageManager.setLanguage(LanguageManager::Language::ENGLISH);
     m_guiManager.initGui();    
 
@@ -39,14 +50,21 @@ void GameState::handleEvent(const sf::Event& event) {
         m_entityManager.handleEvent(event);   
 
     if (event.type == sf::Event::Closed) m_shouldEnd = true;
+
+#ifndef NDEBUG
+    if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::BackSpace) 
+        rewind();
+#endif
 }
 
 sf::Time MAX_LOADING_TICK = sf::seconds(0.015f);
 
+const sf::Time REWIND_SNAPSHOT_PERIOD = sf::seconds(1.f);
+const int MAX_REWIND_SNAPSHOTS = 10;
+
 void GameState::update() {
     sf::Time elapsedTime = m_tickClock.restart();
 
-    m_soundManager.update();
     m_guiManager.update(elapsedTime);
 
     if (m_guiManager.isMenuOpen()) return;
@@ -56,25 +74,106 @@ void GameState::update() {
                 && m_tickClock.getElapsedTime() < MAX_LOADING_TICK)
             m_landManager.load();
 
+        if (!m_landManager.isLoading() && !m_startSnapshot)
+            m_startSnapshot = getSnapshot();
+
         return;
     }
 
+    m_stepAccumulator = std::min(m_stepAccumulator + elapsedTime, MAX_SIMULATED_FRAME);
+    while (m_stepAccumulator >= SIMULATION_STEP) {
+        step(SIMULATION_STEP);
+        m_stepAccumulator -= SIMULATION_STEP;
+    }
+    m_interpolation = m_stepAccumulator / SIMULATION_STEP;
+
+    sf::View view = getView();
+    m_soundManager.setListener(view.getCenter().x, view.getSize().x / 2.f);
+}
+
+void GameState::simulateStep() {
+    while (m_landManager.isLoading())
+        m_landManager.load();
+
+    if (!m_startSnapshot)
+        m_startSnapshot = getSnapshot();
+
+    step(SIMULATION_STEP);
+}
+
+void GameState::step(sf::Time elapsedTime) {
+    m_currentTime += elapsedTime;
+
+    m_timers.advance([this](TimerWheel::Event event) {
+        m_entityManager.handleTimer(event);
+    });
+
     m_entityManager.update(elapsedTime);
     m_landManager.update();
 
     checkShouldReset(elapsedTime);
     
     m_scoreManager.update(elapsedTime);
+
+    if (isRewindEnabled())
+        takeRewindSnapshot(elapsedTime);
 }
 
-void GameState::reset() {  
-    m_clock.restart();
+void GameState::takeRewindSnapshot(sf::Time elapsedTime) {
+    m_rewindSnapshotDelay -= elapsedTime;
+    if (m_rewindSnapshotDelay <= sf::Time::Zero) {
+        m_rewindSnapshots.push_back(getSnapshot());
+        if (std::ssize(m_rewindSnapshots) > MAX_REWIND_SNAPSHOTS)
+            m_rewindSnapshots.pop_front();
 
+        m_rewindSnapshotDelay = REWIND_SNAPSHOT_PERIOD;
+    }
+}
+
+void GameState::reset() {  
     m_guiManager.reset();
 
-    m_scoreManager.reset();
-    m_entityManager.reset();
-    m_landManager.reset();
+    m_rewindSnapshots.clear();
+    m_rewindSnapshotDelay = sf::Time::Zero;
+
+    if (m_startSnapshot) {
+        restore(*m_startSnapshot);
+    } else {
+        m_currentTime = sf::Time::Zero;
+
+        m_timers.clear();
+        m_scoreManager.reset();
+        m_entityManager.reset();
+        m_landManager.reset();
+    }
+}
+
+GameState::Snapshot GameState::getSnapshot() const {
+    return {m_randomEngine, getCurrentTime(), m_timers, m_entityManager.getSnapshot(), 
+            m_landManager.getSnapshot(), m_scoreManager.getSnapshot()};
+}
+
+void GameState::restore(const Snapshot& snapshot) {
+    m_randomEngine = snapshot.randomEngine;
+
+    m_currentTime = snapshot.currentTime;
+    m_timers = snapshot.timers;
+
+    m_scoreManager.restore(snapshot.score);
+    m_entityManager.restore(snapshot.entities);
+    m_landManager.restore(snapshot.land);
+
+    m_resetTimer.reset();
+}
+
+bool GameState::rewind() {
+    if (m_rewindSnapshots.empty()) 
+        return false;
+
+    restore(m_rewindSnapshots.back());
+    m_rewindSnapshots.pop_back();
+    m_rewindSnapshotDelay = REWIND_SNAPSHOT_PERIOD;
+    return true;
 }
 
 bool GameState::inActiveArea(float x) const noexcept {
@@ -98,8 +197,14 @@ void GameState::draw(sf::RenderTarget& target, sf::RenderStates states) const {
     target.draw(m_guiManager, states);
 }
 
-sf::View GameState::getView() const noexcept {
-    float playerX = getEntities().getPlayerPosition().x;
+bool GameState::inViewArea(sf::FloatRect bounds, float margin) const noexcept {
+    sf::View view = getViewFor(getEntities().getPlayerPosition().x);
+    float nearLeft  = view.getCenter().x - view.getSize().x / 2.f - margin;
+    float nearRight = view.getCenter().x + view.getSize().x / 2.f + margin;
+    return intersects(left(bounds), right(bounds), nearLeft, nearRight);
+}
+
+sf::View GameState::getViewFor(float playerX) const noexcept {
     float aspectRatio = getScreenSize().x / getScreenSize().y;
     return sf::View{{playerX - getGameHeight() / 2.f, -getGameHeight() / 2.f, 
                      getGameHeight() * aspectRatio, getGameHeight()}};
@@ -36,10 +36,18 @@ If not, see <https://www.gnu.org/licenses/>. */
 #include <concepts>
 #include <memory>
 #include <deque>
+#include <optional>
 
 class GameState : public sf::Drawable {
 public:
-    GameState(sf::Vector2f screenSize);
+    enum class Mode {
+        INTERACTIVE, 
+        HEADLESS // no input, sound or best score file, advanced only by simulateStep
+    };
+
+    // assets are shared with other game states
+    GameState(sf::Vector2f screenSize, std::shared_ptr<const AssetManager> assets, 
+              Mode mode = Mode::INTERACTIVE, uint64_t seed = std::random_device{}());
 
     GameState(const GameState&) noexcept = delete;
     GameState& operator=(const GameState&) noexcept = delete;
@@ -47,7 +55,11 @@ public:
     GameState& operator=(GameState&&) noexcept = delete;
 
     const AssetManager& getAssets() const noexcept {
-        return m_assetManager;
+        return *m_assetManager;
+    }
+
+    bool isHeadless() const noexcept {
+        return m_mode == Mode::HEADLESS;
     }
 
     template<std::invocable<std::mt19937_64&> Distribution>
@@ -95,6 +107,10 @@ public:
         return m_soundManager;
     }
 
+    TimerWheel& getTimers() noexcept {
+        return m_timers;
+    }
+
     const ScoreManager& getScoreManager() const noexcept {
         return m_scoreManager;
     }
@@ -103,12 +119,30 @@ public:
         return m_scoreManager;
     }
 
+    // counters of the last draw
+    DrawStats getEntityDrawStats() const noexcept {
+        return m_entityManager.getDrawStats();
+    }
+
+    // in tiles
+    DrawStats getLandDrawStats() const noexcept {
+        return m_landManager.getDrawStats();
+    }
+
     sf::Vector2f getScreenSize() const noexcept {
         return m_screenSize;
     }
 
     bool inActiveArea(float x) const noexcept;
 
+    // view with a margin, entities outside of it only coast
+    bool inNearArea(sf::FloatRect bounds) const noexcept {
+        return inViewArea(bounds, getGameHeight() / 2.f);
+    }
+
+    // view at the simulated player position
+    bool inViewArea(sf::FloatRect bounds, float margin = 0.f) const noexcept;
+
     void setShouldResetAfter(sf::Time time) noexcept {
         m_resetTimer.start(time);
     }
@@ -121,23 +155,50 @@ public:
         m_shouldEnd = shouldEnd;
     }
 
+    // part of the simulation step passed since the last step, in [0, 1)
+    float getInterpolation() const noexcept {
+        return m_interpolation;
+    }
+
+    // simulated time, stands still while paused or loading
     sf::Time getCurrentTime() const noexcept {
-        return m_clock.getElapsedTime();
+        return m_currentTime;
     }
 
+    // state of the world without gui, sounds and assets
+    struct Snapshot {
+        std::mt19937_64 randomEngine;
+        sf::Time currentTime;
+        TimerWheel timers;
+        EntityManager::Snapshot entities;
+        LandManager::Snapshot land;
+        ScoreManager::Snapshot score;
+    };
+
+    Snapshot getSnapshot() const;
+    void restore(const Snapshot& snapshot);
+
+    // restore the last periodic snapshot, return false if there is none
+    bool rewind();
+
     void handleEvent(const sf::Event& event);
 
     void update();
 
+    // load land if needed and simulate one step ignoring wall time and menus
+    void simulateStep();
+
     void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
 
     bool isLoading() noexcept {
         return m_landManager.isLoading();
     }
 private:
+    Mode m_mode;
+
     std::mt19937_64 m_randomEngine;
 
-    AssetManager m_assetManager;
+    std::shared_ptr<const AssetManager> m_assetManager;
 
     EntityManager m_entityManager;
 
@@ -149,8 +210,21 @@ private:
 
     Gui::Manager m_guiManager;
 
+    // advanced once per simulation step
+    TimerWheel m_timers;
+
     sf::Clock m_tickClock;
-    sf::Clock m_clock;
+    // frame time not simulated yet
+    sf::Time m_stepAccumulator;
+    float m_interpolation;
+    // advanced only by simulation steps
+    sf::Time m_currentTime;
+
+    // taken when loading finishes, restored on reset
+    std::optional<Snapshot> m_startSnapshot;
+
+    std::deque<Snapshot> m_rewindSnapshots;
+    sf::Time m_rewindSnapshotDelay;
 
     ScoreManager m_scoreManager;
 
@@ -161,10 +235,27 @@ private:
 
     bool m_shouldEnd;
 
-    sf::View getView() const noexcept;
+    sf::View getView() const noexcept {
+        return getViewFor(getEntities().getInterpolatedPlayerPosition().x);
+    }
+
+    sf::View getViewFor(float playerX) const noexcept;
 
     void reset();
 
+    void step(sf::Time elapsedTime);
+
+    // periodic snapshots are only needed by the debug rewind hotkey
+    bool isRewindEnabled() const noexcept {
+#ifndef NDEBUG
+        return !isHeadless();
+#else
+        return false;
+#endif
+    }
+
+    void takeRewindSnapshot(sf::Time elapsedTime);
+
     void checkShouldReset(sf::Time elapsedTime) {
         if (!m_resetTimer.isFinished()) {
             m_resetTimer.update(elapsedTime);
@@ -24,6 +24,6 @@ If not, see <https://www.gnu.org/licenses/>. */
 #include "Panel.h"
 #include "Text.h"
 
-#include "drawNumber.h"
+#include "Hud.h"
 
 #endif
\ No newline at end of file
@@ -0,0 +1,111 @@
+/* This file is part of Jutchs Shmup.
+
+Jutchs Shmup is free software: you can redistribute it and/or modify it 
+under the terms of the GNU General Public License as published by the Free Software Foundation, 
+either version 3 of the License, or (at your option) any later version.
+
+Jutchs Shmup is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with Jutchs Shmup. 
+If not, see <https://www.gnu.org/licenses/>. */
+
+#include "Hud.h"
+
+#include <string>
+#include <algorithm>
+#include <cmath>
+
+namespace Gui {
+    namespace {
+        // append quad with top left corner at position
+        // return its size
+        sf::Vector2f appendQuad(std::vector<sf::Vertex>& vertices, 
+                sf::Vector2f position, sf::IntRect textureRect, float scale = 1.f) {
+            sf::Vector2f size(textureRect.width * scale, textureRect.height * scale);
+
+            float left   = textureRect.left;
+            float top    = textureRect.top;
+            float right  = left + textureRect.width;
+            float bottom = top  + textureRect.height;
+
+            vertices.emplace_back(position                           , sf::Vector2f{left , top   });
+            vertices.emplace_back(position + sf::Vector2f{size.x, 0.f}, sf::Vector2f{right, top   });
+            vertices.emplace_back(position + size                    , sf::Vector2f{right, bottom});
+            vertices.emplace_back(position + sf::Vector2f{0.f, size.y}, sf::Vector2f{left , bottom});
+
+            return size;
+        }
+    }
+
+    bool CachedNumber::setValue(int value, const AssetManager& assets) {
+        if (m_value == value) return false;
+        m_value = value;
+
+        m_vertices.clear();
+        m_size = {0.f, 0.f};
+
+        if (value < 0 || m_sign == Sign::ALWAYS) {
+            auto signRect = value < 0 ? assets.getHudMinusRect() : assets.getHudPlusRect();
+            m_size.x += appendQuad(m_vertices, {m_size.x, 0.f}, signRect).x;
+        }
+
+        auto digits = std::to_string(std::abs(value));
+        for (char digit : digits) {
+            auto size = appendQuad(m_vertices, {m_size.x, 0.f}, assets.getHudDigitRect(digit - '0'));
+            m_size.x += size.x;
+            m_size.y = std::max(size.y, m_size.y);
+        }
+
+        return true;
+    }
+
+    void CachedNumber::appendTo(std::vector<sf::Vertex>& vertices, sf::Vector2f position) const {
+        for (sf::Vertex vertex : m_vertices) {
+            vertex.position += position;
+            vertices.push_back(vertex);
+        }
+    }
+
+    void Hud::update(int health, int score, int bestScore, int scoreChange) {
+        bool changed = health != m_health;
+        m_health = health;
+
+        // don't short circuit, every number must be updated
+        changed |= m_score.setValue(score, m_assets);
+        changed |= m_bestScore.setValue(bestScore, m_assets);
+        changed |= m_scoreChange.setValue(scoreChange, m_assets);
+
+        if (changed) rebuild();
+    }
+
+    void Hud::rebuild() {
+        m_vertices.clear();
+
+        // health at top left, hearts are scaled for visibility
+        sf::IntRect healthRect = m_assets.getHudHealthRect();
+        for (int i = 0; i < m_health; ++ i)
+            appendQuad(m_vertices, {2.f * i * healthRect.width, 0.f}, healthRect, 2.f);
+
+        // score / best score under it
+        sf::Vector2f position{0.f, 2.f * healthRect.height};
+        m_score.appendTo(m_vertices, position);
+        position.x += m_score.getSize().x;
+
+        position.x += appendQuad(m_vertices, position, m_assets.getHudSlashRect()).x;
+
+        m_bestScore.appendTo(m_vertices, position);
+
+        // pending score change under score
+        if (m_scoreChange.getValue() != 0)
+            m_scoreChange.appendTo(m_vertices, {0.f, position.y + m_score.getSize().y});
+    }
+
+    void Hud::draw(sf::RenderTarget& target, sf::RenderStates states) const {
+        if (m_vertices.empty()) return;
+
+        states.texture = &m_assets.getHudTexture();
+        target.draw(m_vertices.data(), m_vertices.size(), sf::Quads, states);
+    }
+}
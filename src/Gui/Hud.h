@@ -0,0 +1,84 @@
+/* This file is part of Jutchs Shmup.
+
+Jutchs Shmup is free software: you can redistribute it and/or modify it 
+under the terms of the GNU General Public License as published by the Free Software Foundation, 
+either version 3 of the License, or (at your option) any later version.
+
+Jutchs Shmup is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with Jutchs Shmup. 
+If not, see <https://www.gnu.org/licenses/>. */
+
+#ifndef GUI_HUD_H_
+#define GUI_HUD_H_
+
+#include "../AssetManager.h"
+
+#include <SFML/Graphics.hpp>
+#include <SFML/System.hpp>
+
+#include <vector>
+#include <optional>
+
+namespace Gui {
+    // quads of a number textured with HUD texture
+    // rebuilt only when the value changes
+    class CachedNumber {
+    public:
+        enum class Sign {
+            IF_NEGATIVE,
+            ALWAYS,
+        };
+
+        explicit CachedNumber(Sign sign = Sign::IF_NEGATIVE) noexcept : 
+            m_size{0.f, 0.f}, m_sign{sign} {}
+
+        // return true if vertices were rebuilt
+        bool setValue(int value, const AssetManager& assets);
+
+        // 0 if never set
+        int getValue() const noexcept {
+            return m_value.value_or(0);
+        }
+
+        // element's origin at its top left corner
+        sf::Vector2f getSize() const noexcept {
+            return m_size;
+        }
+
+        void appendTo(std::vector<sf::Vertex>& vertices, sf::Vector2f position) const;
+    private:
+        std::vector<sf::Vertex> m_vertices;
+        sf::Vector2f m_size;
+
+        std::optional<int> m_value;
+        Sign m_sign;
+    };
+
+    // health and score drawn in one draw call
+    class Hud : public sf::Drawable {
+    public:
+        Hud(const AssetManager& assets) noexcept : 
+            m_assets{assets}, m_health{-1}, m_scoreChange{CachedNumber::Sign::ALWAYS} {}
+
+        // rebuild vertices only if something changed
+        void update(int health, int score, int bestScore, int scoreChange);
+    private:
+        const AssetManager& m_assets;
+
+        int m_health;
+        CachedNumber m_score;
+        CachedNumber m_bestScore;
+        CachedNumber m_scoreChange;
+
+        std::vector<sf::Vertex> m_vertices;
+
+        void rebuild();
+
+        void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+    };
+}
+
+#endif
@@ -29,10 +29,14 @@ namespace Gui {
 
     Manager::Manager(GameState& gameState) : 
         m_gameState{gameState}, m_menuOpen{false}, 
-        m_loadingDots{0}, m_loadingDotsChangeDelay{LOADING_DOTS_CHANGE_DELAY} {}
+        m_layoutCount{0}, m_loadingText{&m_layoutCount}, 
+        m_loadingDots{0}, m_loadingDotsChangeDelay{LOADING_DOTS_CHANGE_DELAY}, 
+        m_bestScoreText{&m_layoutCount}, 
+        m_layoutStatsTime{sf::Time::Zero}, m_layoutCountBefore{0}, 
+        m_layoutsPerSecond{0}, m_hud{gameState.getAssets()} {}
 
     sf::Vector2f Manager::addMenuText(sf::Vector2f position) {
-        auto menuText = std::make_unique<Text>();
+        auto menuText = std::make_unique<Text>(&m_layoutCount);
         menuText->setString(m_gameState.getLanguageManager().getMenuText());
         menuText->setStyle(m_gameState.getAssets().getFont(), 100, sf::Color::White);
         
@@ -47,7 +51,7 @@ namespace Gui {
     sf::Vector2f Manager::addVolumeSlider(sf::Vector2f position) {
         sf::Vector2f screenSize = m_gameState.getScreenSize();
 
-        auto volumeText = std::make_unique<Text>();
+        auto volumeText = std::make_unique<Text>(&m_layoutCount);
         volumeText->setString(m_gameState.getLanguageManager().getVolumeText());
         volumeText->setStyle(m_gameState.getAssets().getFont(), 50, sf::Color::White);
         
@@ -93,14 +97,14 @@ namespace Gui {
         float comboTextPadding = screenSize.y / 10.f;
         sf::Vector2f comboSize{comboTextPadding, comboTextPadding}; // .x will be updated
 
-        auto englishText = std::make_unique<Text>();
+        auto englishText = std::make_unique<Text>(&m_layoutCount);
         englishText->setString(languageManager.getLanguageName(LanguageManager::Language::ENGLISH));
         englishText->setStyle(font, 50, sf::Color::White);
         englishText->setOrigin({englishText->getSize().x / 2.f, englishText->getSize().y * (2.f / 3.f)});
         englishText->setPosition({0.f, comboSize.y / 2.f}); // at the center of the combo
         comboSize.x = std::max(englishText->getSize().x + comboTextPadding, comboSize.x);
 
-        auto russianText = std::make_unique<Text>();
+        auto russianText = std::make_unique<Text>(&m_layoutCount);
         russianText->setString(languageManager.getLanguageName(LanguageManager::Language::RUSSIAN));
         russianText->setStyle(font, 50, sf::Color::White);
         russianText->setOrigin({russianText->getSize().x / 2.f, russianText->getSize().y * (2.f / 3.f)});
@@ -134,14 +138,14 @@ namespace Gui {
         float buttonTextPadding = screenSize.y / 10.f;
         sf::Vector2f buttonSize{buttonTextPadding, buttonTextPadding}; // .x will be updated
 
-        auto resumeText = std::make_unique<Text>();
+        auto resumeText = std::make_unique<Text>(&m_layoutCount);
         resumeText->setString(languageManager.getResumeText());
         resumeText->setStyle(font, 80, sf::Color::White);
         resumeText->setOrigin({resumeText->getSize().x / 2.f, resumeText->getSize().y});
         resumeText->setPosition({0.f, -buttonSize.y / 2.f}); // place in the center of the button
         buttonSize.x = std::max(resumeText->getSize().x + buttonTextPadding, buttonSize.x);
 
-        auto exitText = std::make_unique<Text>();
+        auto exitText = std::make_unique<Text>(&m_layoutCount);
         exitText->setString(languageManager.getExitText());
         exitText->setStyle(font, 80, sf::Color::White);
         exitText->setOrigin({exitText->getSize().x / 2.f, exitText->getSize().y});
@@ -186,7 +190,11 @@ namespace Gui {
     }
 
     sf::Vector2f Manager::createLoadingText(sf::Vector2f position) {
-        m_loadingText.setString(m_gameState.getLanguageManager().getLoadingText());
+        for (int dots = 0; dots < std::ssize(m_loadingStrings); ++ dots)
+            m_loadingStrings[dots] = m_gameState.getLanguageManager().getLoadingText() 
+                                   + std::string(dots, '.');
+
+        m_loadingText.setString(m_loadingStrings[0]);
         m_loadingText.setStyle(m_gameState.getAssets().getFont(), 80, sf::Color::White);
 
         m_loadingText.setOrigin(m_loadingText.getSize() / 2.f);
@@ -200,6 +208,7 @@ namespace Gui {
         m_bestScoreText.setPosition(position);
 
         setBestScoreText(m_gameState.getLanguageManager().getBestScoreText());
+        m_shownBestScore = std::nullopt;
 
         return m_bestScoreText.getSize();
     }
@@ -209,6 +218,15 @@ namespace Gui {
         m_bestScoreText.setOrigin({m_bestScoreText.getSize().x / 2.f, 0.f});
     }
 
+    void Manager::updateBestScoreText() {
+        int bestScore = static_cast<int>(m_gameState.getScoreManager().getBestScore());
+        if (m_shownBestScore == bestScore) return;
+
+        setBestScoreText(m_gameState.getLanguageManager().getBestScoreText() 
+                         + ' ' + std::to_string(bestScore));
+        m_shownBestScore = bestScore;
+    }
+
     void Manager::initGui() {
         sf::Vector2f screenSize = m_gameState.getScreenSize();
 
@@ -250,43 +268,38 @@ namespace Gui {
         if (m_gameState.isLoading()) {
             m_loadingDotsChangeDelay -= elapsedTime;
             if (m_loadingDotsChangeDelay <= sf::Time::Zero) {
-                if (++ m_loadingDots > 3)
+                if (++ m_loadingDots >= std::ssize(m_loadingStrings))
                     m_loadingDots = 0;
 
-                std::string newLoadingText = m_gameState.getLanguageManager().getLoadingText();
-                for (int i = 0; i < m_loadingDots; ++ i)
-                    newLoadingText.push_back('.');
-                m_loadingText.setString(newLoadingText);
+                m_loadingText.setString(m_loadingStrings[m_loadingDots]);
 
                 m_loadingDotsChangeDelay = LOADING_DOTS_CHANGE_DELAY;
             }
 
-            std::string bestScoreString = m_gameState.getLanguageManager().getBestScoreText()
-                + ' ' + std::to_string(static_cast<int>(m_gameState.getScoreManager().getBestScore()));
-            setBestScoreText(bestScoreString);
+            updateBestScoreText();
         }
-    }
 
-    sf::Vector2f Manager::drawHealth(sf::Vector2f position, 
-            sf::RenderTarget& target, sf::RenderStates states) const {
-        int health = m_gameState.getEntities().getPlayerHealth();
+        updateLayoutStats(elapsedTime);
+
+        const auto& scoreManager = m_gameState.getScoreManager();
+        m_hud.update(m_gameState.getEntities().getPlayerHealth(), 
+            static_cast<int>(scoreManager.getScore()), static_cast<int>(scoreManager.getBestScore()), 
+            static_cast<int>(scoreManager.getScoreChange()));
+    }
 
-        const auto& assets = m_gameState.getAssets();
-        auto healthSize = 2u * assets.getHealthTexture().getSize();
-        sf::Sprite healthSprite{assets.getHealthTexture()};
-        healthSprite.scale(2, 2);
+    void Manager::updateLayoutStats(sf::Time elapsedTime) noexcept {
+        m_layoutStatsTime += elapsedTime;
+        if (m_layoutStatsTime >= sf::seconds(1.f)) {
+            m_layoutsPerSecond = static_cast<int>((m_layoutCount - m_layoutCountBefore) 
+                                                  / m_layoutStatsTime.asSeconds());
 
-        for (int i = 0; i < health; ++ i) {
-            healthSprite.setPosition(position.x + i * healthSize.x, position.y);
-            target.draw(healthSprite, states);
+            m_layoutCountBefore = m_layoutCount;
+            m_layoutStatsTime = sf::Time::Zero;
         }
-
-        return sf::Vector2f(health * healthSize.x, healthSize.y);
     }
 
     void Manager::draw(sf::RenderTarget& target, sf::RenderStates states) const {
-        auto healthSize = drawHealth({0.f, 0.f}, target, states);
-        m_gameState.getScoreManager().drawGui({0.f, healthSize.y}, target, states);
+        target.draw(m_hud, states);
 
         if (m_menuOpen) target.draw(m_menu, states);
     }
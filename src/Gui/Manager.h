@@ -16,9 +16,15 @@ If not, see <https://www.gnu.org/licenses/>. */
 
 #include "Panel.h"
 #include "Text.h"
+#include "Hud.h"
 
 #include <SFML/Graphics.hpp>
 
+#include <array>
+#include <string>
+#include <optional>
+#include <cstdint>
+
 class GameState;
 
 namespace Gui {
@@ -43,16 +49,33 @@ namespace Gui {
             m_loadingDots = 0;
             m_loadingDotsChangeDelay = LOADING_DOTS_CHANGE_DELAY;
         }
+
+        // number of Gui::Text layouts during the last full second
+        int getLayoutsPerSecond() const noexcept {
+            return m_layoutsPerSecond;
+        }
     private:
         GameState& m_gameState;
         bool m_menuOpen;
         Gui::Panel m_menu;
 
+        // layouts of texts of this manager only, other game states have own managers
+        int64_t m_layoutCount;
+
         Gui::Text m_loadingText;
         int m_loadingDots;
         sf::Time m_loadingDotsChangeDelay;
+        // loading text with every number of dots
+        std::array<std::string, 4> m_loadingStrings;
 
         Gui::Text m_bestScoreText;
+        std::optional<int> m_shownBestScore; // nullopt if text must be updated
+
+        sf::Time m_layoutStatsTime;
+        int64_t m_layoutCountBefore;
+        int m_layoutsPerSecond;
+
+        Gui::Hud m_hud;
 
         const static inline sf::Time LOADING_DOTS_CHANGE_DELAY = sf::seconds(0.1f);
 
@@ -75,11 +98,10 @@ namespace Gui {
         sf::Vector2f createBestScoreText(sf::Vector2f position);
 
         void setBestScoreText(const std::string& text);
-        
-        // return element size
-        // element's origin at its top left corner
-        sf::Vector2f drawHealth(sf::Vector2f position, 
-            sf::RenderTarget& target, sf::RenderStates states) const;
+        void updateBestScoreText();
+
+        void updateLayoutStats(sf::Time elapsedTime) noexcept;
+
     };
 }
 
@@ -20,11 +20,14 @@ If not, see <https://www.gnu.org/licenses/>. */
 #include <SFML/System.hpp>
 
 #include <string>
+#include <cstdint>
 
 namespace Gui {
     class Text : public Element {
     public:
-        Text() noexcept = default;
+        // layouts are added to *layoutCounter if it isn't null
+        explicit Text(int64_t* layoutCounter = nullptr) noexcept : 
+            m_layoutCounter{layoutCounter} {}
         
         sf::Vector2f getSize() const noexcept {
             auto localBounds = m_text.getLocalBounds();
@@ -39,17 +42,35 @@ namespace Gui {
             m_text.setOrigin(origin);
         }
 
+        // text is laid out again only if string has changed
         void setString(const std::string& string) noexcept {
+            if (string == m_string) return;
+
+            m_string = string;
             m_text.setString(sf::String::fromUtf8(string.begin(), string.end()));
+            countLayout();
         }
 
+        // text is laid out again only if font or character size have changed
         void setStyle(const sf::Font& font, int characterSize, sf::Color color) noexcept {
             m_text.setFillColor(color);
+
+            if (m_text.getFont() == &font 
+             && m_text.getCharacterSize() == static_cast<unsigned int>(characterSize)) return;
+
             m_text.setFont(font);
             m_text.setCharacterSize(characterSize);
+            countLayout();
         }
     private:
         sf::Text m_text;
+        std::string m_string;
+
+        int64_t* m_layoutCounter;
+
+        void countLayout() noexcept {
+            if (m_layoutCounter) ++ *m_layoutCounter;
+        }
 
         void draw(sf::RenderTarget& target, sf::RenderStates states) const noexcept override {
             target.draw(m_text, states);
@@ -0,0 +1,41 @@
+/* This file is part of Jutchs Shmup.
+
+Jutchs Shmup is free software: you can redistribute it and/or modify it 
+under the terms of the GNU General Public License as published by the Free Software Foundation, 
+either version 3 of the License, or (at your option) any later version.
+
+Jutchs Shmup is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with Jutchs Shmup. 
+If not, see <https://www.gnu.org/licenses/>. */
+
+#include "HeadlessRunner.h"
+
+namespace {
+    // only aspect ratio matters, it sets the view size
+    const sf::Vector2f HEADLESS_SCREEN_SIZE{1920.f, 1080.f};
+}
+
+HeadlessRunner::HeadlessRunner(std::shared_ptr<const AssetManager> assets, 
+                               int worldCount, int threadCount, uint64_t seed) : 
+        m_workers{threadCount} {
+    m_worlds.reserve(worldCount);
+    for (int i = 0; i < worldCount; ++ i)
+        m_worlds.push_back(std::make_unique<GameState>(HEADLESS_SCREEN_SIZE, assets, 
+                                                       GameState::Mode::HEADLESS, seed + i));
+}
+
+sf::Time HeadlessRunner::run(int stepCount) {
+    sf::Clock clock;
+    m_workers.run([this, stepCount](int thread) {
+        // contiguous chunks, every world stays on one thread for all steps
+        int64_t begin = std::ssize(m_worlds) *  thread      / getThreadCount();
+        int64_t end   = std::ssize(m_worlds) * (thread + 1) / getThreadCount();
+        for (int64_t i = begin; i < end; ++ i)
+            for (int step = 0; step < stepCount; ++ step)
+                m_worlds[i]->simulateStep();
+    });
+    return clock.getElapsedTime();
+}
@@ -0,0 +1,56 @@
+/* This file is part of Jutchs Shmup.
+
+Jutchs Shmup is free software: you can redistribute it and/or modify it 
+under the terms of the GNU General Public License as published by the Free Software Foundation, 
+either version 3 of the License, or (at your option) any later version.
+
+Jutchs Shmup is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with Jutchs Shmup. 
+If not, see <https://www.gnu.org/licenses/>. */
+
+#ifndef HEADLESS_RUNNER_H_
+#define HEADLESS_RUNNER_H_
+
+#include "GameState.h"
+#include "AssetManager.h"
+#include "WorkerPool.h"
+
+#include <SFML/System.hpp>
+
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+// independent headless game states sharing assets, stepped in parallel
+class HeadlessRunner {
+public:
+    // world i is seeded with seed + i so runs are reproducible
+    HeadlessRunner(std::shared_ptr<const AssetManager> assets, 
+                   int worldCount, int threadCount, uint64_t seed = 0);
+
+    // simulate stepCount steps of every world, return wall time it took
+    // the first step of a world also loads its land
+    sf::Time run(int stepCount);
+
+    int getWorldCount() const noexcept {
+        return static_cast<int>(std::ssize(m_worlds));
+    }
+
+    int getThreadCount() const noexcept {
+        return m_workers.getThreadCount();
+    }
+
+    const GameState& getWorld(int i) const noexcept {
+        return *m_worlds[i];
+    }
+private:
+    // GameState can't be moved
+    std::vector<std::unique_ptr<GameState>> m_worlds;
+
+    WorkerPool m_workers;
+};
+
+#endif
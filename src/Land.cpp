@@ -13,66 +13,253 @@ If not, see <https://www.gnu.org/licenses/>. */
 
 #include "Land.h"
 
-bool isModifiable(Land type) noexcept {
-    using enum Land;
-    switch (type & ~MODIFIED & ~BADLAND) {
-        case FEATURE | PLAINS    :
-        case FEATURE | TREE      :
-        case FEATURE | HOUSE     :
-        case ROAD | NORTH | SOUTH:
-        case ROAD | EAST  | WEST :
-        case WATER               :
-        case WATER | NORTH | EAST:
-        case WATER | NORTH | WEST:
-        case WATER | SOUTH | EAST:
-        case WATER | SOUTH | WEST:
-            return true;
-        default:
+namespace {
+    constexpr bool isModifiableRule(Land type) noexcept {
+        using enum Land;
+        switch (type & ~MODIFIED & ~BADLAND) {
+            case FEATURE | PLAINS    :
+            case FEATURE | TREE      :
+            case FEATURE | HOUSE     :
+            case ROAD | NORTH | SOUTH:
+            case ROAD | EAST  | WEST :
+            case WATER               :
+            case WATER | NORTH | EAST:
+            case WATER | NORTH | WEST:
+            case WATER | SOUTH | EAST:
+            case WATER | SOUTH | WEST:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    constexpr bool hasBadlandVariantRule(Land land) noexcept {
+        return land != (Land::FEATURE | Land::BUSH) 
+            && land != Land::WATER;
+    }
+
+    constexpr bool isValidRule(Land type) noexcept {
+        using Base = std::underlying_type_t<Land>;
+        using enum Land;
+        if (test(type, ROAD)) {
+            return static_cast<Base>(type & DIR_MASK) < LAND_ROAD_VARIANTS
+                && test(type, DIR_MASK)
+                && (!test(type, MODIFIED) || isModifiableRule(type));
+        } else if (test(type, WATER)) {
+            return static_cast<std::underlying_type_t<Land>>(type & DIR_MASK) < LAND_WATER_VARIANTS
+                && ((type & DIR_MASK) != (NORTH | SOUTH))
+                && ((type & DIR_MASK) != (WEST  | EAST ))
+                && (getActiveDirCount(type) != 3)
+                && (!test(type, MODIFIED) || isModifiableRule(type));
+        } else if ((type & ~FEATURE & ~MODIFIED & ~BADLAND) == BUSH) {
+            return !test(type, BADLAND) && !test(type, MODIFIED);
+        } else
+            return static_cast<Base>(type & ~FEATURE & ~MODIFIED & ~BADLAND) < LAND_FEATURE_VARIANTS && 
+                (!test(type, MODIFIED) || isModifiableRule(type));
+    }
+
+    constexpr bool hasWaterAnyRule(Land type, Land side) noexcept {
+        using enum Land;
+
+        if (!test(type, WATER)) return false;
+
+        if (!test(type, DIR_MASK)) return true;
+        if (test(type, side)) return true;
+
+        if (test(type, MODIFIED)) return false;
+        switch (side) {
+            case NORTH: 
+            case SOUTH: 
+                return test(type, WEST) || test(type, EAST);
+            case WEST: 
+            case EAST: 
+                return test(type, NORTH) || test(type, SOUTH);
+            default:
+                return false; // invalid
+        }
+    }
+
+    constexpr bool isCompatableHorizontalRule(Land left, Land right) noexcept {
+        using enum Land;
+
+        if (hasRoadSide(left, EAST) != hasRoadSide(right, WEST))
+            return false;
+    
+        if (hasRoadSide(left, NORTH) && hasRoadSide(right, NORTH)
+        || hasRoadSide(left, SOUTH) && hasRoadSide(right, SOUTH))
+            return false;
+
+        bool leftWater  = hasWaterSide(left, EAST);
+        bool rightWater = hasWaterSide(right, WEST);
+        if (leftWater != rightWater)
+            return false;
+    
+        if (!leftWater && test(left, BADLAND) != test(right, BADLAND))
+            return false;
+
+        if (   hasWaterCorner(left,  NORTH | EAST) 
+            != hasWaterCorner(right, NORTH | WEST)
+        ||     hasWaterCorner(left,  SOUTH | EAST) 
+            != hasWaterCorner(right, SOUTH | WEST))
+            return false;
+    
+        return true;
+    }
+
+    constexpr bool isCompatableVerticalRule(Land up, Land down) noexcept {
+        using enum Land;
+
+        if (hasRoadSide(up, SOUTH) != hasRoadSide(down, NORTH))
             return false;
+    
+        if (hasRoadSide(up, EAST) && hasRoadSide(down, EAST)
+            || hasRoadSide(up, WEST) && hasRoadSide(down, WEST))
+            return false;
+
+        bool upWater   = hasWaterSide(up, SOUTH);
+        bool downWater = hasWaterSide(down, NORTH);
+        if (upWater != downWater)
+            return false;
+    
+        if (!upWater && test(up, BADLAND) != test(down, BADLAND))
+            return false;
+
+        if (hasWaterCorner(up, SOUTH | EAST) != hasWaterCorner(down, NORTH | EAST)
+            || hasWaterCorner(up, SOUTH | WEST) != hasWaterCorner(down, NORTH | WEST))
+            return false;
+    
+        return true;
     }
-}
 
-bool isValid(Land type) noexcept {
-    using Base = std::underlying_type_t<Land>;
-    using enum Land;
-    if (test(type, ROAD)) {
-        return static_cast<Base>(type & DIR_MASK) < LAND_ROAD_VARIANTS
-            && test(type, DIR_MASK)
-            && (!test(type, MODIFIED) || isModifiable(type));
-    } else if (test(type, WATER)) {
-        return static_cast<std::underlying_type_t<Land>>(type & DIR_MASK) < LAND_WATER_VARIANTS
-            && ((type & DIR_MASK) != (NORTH | SOUTH))
-            && ((type & DIR_MASK) != (WEST  | EAST ))
-            && (getActiveDirCount(type) != 3)
-            && (!test(type, MODIFIED) || isModifiable(type));
-    } else if ((type & ~FEATURE & ~MODIFIED & ~BADLAND) == BUSH) {
-        return !test(type, BADLAND) && !test(type, MODIFIED);
-    } else
-        return static_cast<Base>(type & ~FEATURE & ~MODIFIED & ~BADLAND) < LAND_FEATURE_VARIANTS && 
-            (!test(type, MODIFIED) || isModifiable(type));
-}
+    constexpr bool isCompatableAntiDiagonalRule(Land downLeft, Land upRight) noexcept {
+        using enum Land;
 
-bool hasWaterAny(Land type, Land side) noexcept {
-    using enum Land;
+        if (hasRoadSide(downLeft, EAST) && hasWaterAnyRule(upRight, SOUTH)
+            || hasWaterAnyRule(downLeft, EAST) && hasRoadSide(upRight, SOUTH))
+            return false; // no tiles can be placed at downRight
+
+        if (!hasWaterSide(downLeft, EAST) && !hasWaterSide(upRight, SOUTH)
+            && test(downLeft, BADLAND) != test(upRight, BADLAND))
+            return false; // no tiles can be placed at downRight
+    
+        if (hasWaterCorner(downLeft, NORTH | EAST) 
+            != hasWaterCorner(upRight,  SOUTH | WEST))
+            return false;
+
+        return true;
+    }
 
-    if (!test(type, WATER)) return false;
-
-    if (!test(type, DIR_MASK)) return true;
-    if (test(type, side)) return true;
-
-    if (test(type, MODIFIED)) return false;
-    switch (side) {
-        case NORTH: 
-        case SOUTH: 
-            return test(type, WEST) || test(type, EAST);
-        case WEST: 
-        case EAST: 
-            return test(type, NORTH) || test(type, SOUTH);
-        default:
-            return false; // invalid
+    constexpr bool isCompatableDiagonalRule(Land upLeft, Land downRight) noexcept {
+        if (hasWaterCorner(upLeft,    Land::SOUTH | Land::EAST) 
+         != hasWaterCorner(downRight, Land::NORTH | Land::WEST))
+            return false;
+
+        return true;
+    }
+
+    constexpr int scoreIfDestroyedRule(Land type) noexcept {
+        using enum Land;
+
+        switch (type & ~MODIFIED & ~BADLAND) {
+        case HOUSE       : return -10;
+        case FIELD       : return -10;
+        case PLAYER_FLAG : return -30;
+        case ENEMY_FLAG  : return 100;
+        case AIRDROME    : return 100;
+        default          : return   0;
+        }
+    }
+
+    constexpr Land waterAnySidesRule(Land type) noexcept {
+        using enum Land;
+
+        Land sides = GRASS;
+        for (Land side : {NORTH, EAST, SOUTH, WEST})
+            if (hasWaterAnyRule(type, side))
+                sides |= side;
+        return sides;
+    }
+
+    constexpr LandProperties getPropertiesRule(Land type) noexcept {
+        return {isValidRule(type), isModifiableRule(type), hasBadlandVariantRule(type), 
+                waterAnySidesRule(type), static_cast<int8_t>(scoreIfDestroyedRule(type))};
+    }
+
+    constexpr std::array<LandProperties, LAND_VARIANTS> makePropertiesTable() noexcept {
+        std::array<LandProperties, LAND_VARIANTS> table{};
+        for (size_t i = 0; i < LAND_VARIANTS; ++ i)
+            table[i] = getPropertiesRule(static_cast<Land>(i));
+        return table;
+    }
+
+    using CompatabilityRule = bool (*)(Land, Land) noexcept;
+
+    constexpr LandCompatabilityMatrix makeCompatabilityMatrix(CompatabilityRule rule) noexcept {
+        LandCompatabilityMatrix matrix{};
+        for (size_t first = 0; first < LAND_VARIANTS; ++ first)
+            for (size_t second = 0; second < LAND_VARIANTS; ++ second)
+                if (rule(static_cast<Land>(first), static_cast<Land>(second)))
+                    matrix[first][second / 64] |= uint64_t{1} << (second % 64);
+        return matrix;
+    }
+
+    constexpr bool matchesRules(const std::array<LandProperties, LAND_VARIANTS>& table) noexcept {
+        using enum Land;
+
+        for (size_t i = 0; i < LAND_VARIANTS; ++ i) {
+            Land type = static_cast<Land>(i);
+            const LandProperties& properties = table[i];
+            if (properties.valid            != isValidRule          (type)
+             || properties.modifiable       != isModifiableRule     (type)
+             || properties.badlandVariant   != hasBadlandVariantRule(type)
+             || properties.scoreIfDestroyed != scoreIfDestroyedRule (type))
+                return false;
+
+            for (Land side : {NORTH, EAST, SOUTH, WEST})
+                if (test(properties.waterAnySides, side) != hasWaterAnyRule(type, side))
+                    return false;
+        }
+        return true;
+    }
+
+    constexpr bool matchesRule(const LandCompatabilityMatrix& matrix, CompatabilityRule rule) noexcept {
+        for (size_t first = 0; first < LAND_VARIANTS; ++ first)
+            for (size_t second = 0; second < LAND_VARIANTS; ++ second)
+                if (isCompatable(matrix, static_cast<Land>(first), static_cast<Land>(second))
+                 != rule(static_cast<Land>(first), static_cast<Land>(second)))
+                    return false;
+        return true;
     }
 }
 
+constexpr std::array<LandProperties, LAND_VARIANTS> LAND_PROPERTIES = makePropertiesTable();
+
+constexpr LandCompatabilityMatrix LAND_COMPATABLE_HORIZONTAL 
+    = makeCompatabilityMatrix(isCompatableHorizontalRule);
+constexpr LandCompatabilityMatrix LAND_COMPATABLE_VERTICAL 
+    = makeCompatabilityMatrix(isCompatableVerticalRule);
+constexpr LandCompatabilityMatrix LAND_COMPATABLE_DIAGONAL 
+    = makeCompatabilityMatrix(isCompatableDiagonalRule);
+constexpr LandCompatabilityMatrix LAND_COMPATABLE_ANTI_DIAGONAL 
+    = makeCompatabilityMatrix(isCompatableAntiDiagonalRule);
+
+static_assert(matchesRules(LAND_PROPERTIES));
+static_assert(matchesRule(LAND_COMPATABLE_HORIZONTAL   , isCompatableHorizontalRule  ));
+static_assert(matchesRule(LAND_COMPATABLE_VERTICAL     , isCompatableVerticalRule    ));
+static_assert(matchesRule(LAND_COMPATABLE_DIAGONAL     , isCompatableDiagonalRule    ));
+static_assert(matchesRule(LAND_COMPATABLE_ANTI_DIAGONAL, isCompatableAntiDiagonalRule));
+
+static_assert( isValidRule(Land::FEATURE | Land::BUSH));
+static_assert(!isValidRule(Land::FEATURE | Land::BUSH | Land::BADLAND));
+static_assert(!isValidRule(Land::WATER | Land::NORTH | Land::SOUTH));
+static_assert( isModifiableRule(Land::ROAD | Land::EAST | Land::WEST));
+static_assert( hasWaterAnyRule(Land::WATER | Land::NORTH | Land::EAST, Land::WEST));
+static_assert(!hasWaterAnyRule(Land::WATER | Land::NORTH | Land::EAST | Land::MODIFIED, Land::WEST));
+static_assert(scoreIfDestroyedRule(Land::ENEMY_FLAG | Land::BADLAND) == 100);
+static_assert( isCompatable(LAND_COMPATABLE_HORIZONTAL, Land::ROAD | Land::EAST, Land::ROAD | Land::WEST));
+static_assert(!isCompatable(LAND_COMPATABLE_HORIZONTAL, Land::ROAD | Land::EAST, Land::PLAINS));
+static_assert(!isCompatable(LAND_COMPATABLE_VERTICAL, Land::PLAINS, Land::PLAINS | Land::BADLAND));
+
 std::filesystem::path getTextureFileName(Land type) {
     using enum Land;
     if (test(type, WATER) && !(test(type, DIR_MASK))) {
@@ -175,94 +362,3 @@ std::string getName(Land type) {
         return name;
     }
 }
-
-bool isCompatableHorizontal(Land left, Land right) {
-    using enum Land;
-
-    if (hasRoadSide(left, EAST) != hasRoadSide(right, WEST))
-        return false;
-    
-    if (hasRoadSide(left, NORTH) && hasRoadSide(right, NORTH)
-    || hasRoadSide(left, SOUTH) && hasRoadSide(right, SOUTH))
-        return false;
-
-    bool leftWater  = hasWaterSide(left, EAST);
-    bool rightWater = hasWaterSide(right, WEST);
-    if (leftWater != rightWater)
-        return false;
-    
-    if (!leftWater && test(left, BADLAND) != test(right, BADLAND))
-        return false;
-
-    if (   hasWaterCorner(left,  NORTH | EAST) 
-        != hasWaterCorner(right, NORTH | WEST)
-    ||     hasWaterCorner(left,  SOUTH | EAST) 
-        != hasWaterCorner(right, SOUTH | WEST))
-        return false;
-    
-    return true;
-}
-
-bool isCompatableVertical(Land up, Land down) {
-    using enum Land;
-
-    if (hasRoadSide(up, SOUTH) != hasRoadSide(down, NORTH))
-        return false;
-    
-    if (hasRoadSide(up, EAST) && hasRoadSide(down, EAST)
-        || hasRoadSide(up, WEST) && hasRoadSide(down, WEST))
-        return false;
-
-    bool upWater   = hasWaterSide(up, SOUTH);
-    bool downWater = hasWaterSide(down, NORTH);
-    if (upWater != downWater)
-        return false;
-    
-    if (!upWater && test(up, BADLAND) != test(down, BADLAND))
-        return false;
-
-    if (hasWaterCorner(up, SOUTH | EAST) != hasWaterCorner(down, NORTH | EAST)
-        || hasWaterCorner(up, SOUTH | WEST) != hasWaterCorner(down, NORTH | WEST))
-        return false;
-    
-    return true;
-}
-
-bool isCompatableAntiDiagonal(Land downLeft, Land upRight) {
-    using enum Land;
-
-    if (hasRoadSide(downLeft, EAST) && hasWaterAny(upRight, SOUTH)
-        || hasWaterAny(downLeft, EAST) && hasRoadSide(upRight, SOUTH))
-        return false; // no tiles can be placed at downRight
-
-    if (!hasWaterSide(downLeft, EAST) && !hasWaterSide(upRight, SOUTH)
-        && test(downLeft, BADLAND) != test(upRight, BADLAND))
-        return false; // no tiles can be placed at downRight
-    
-    if (hasWaterCorner(downLeft, NORTH | EAST) 
-        != hasWaterCorner(upRight,  SOUTH | WEST))
-        return false;
-
-    return true;
-}
-
-bool isCompatableDiagonal(Land upLeft, Land downRight) {
-    if (hasWaterCorner(upLeft,    Land::SOUTH | Land::EAST) 
-     != hasWaterCorner(downRight, Land::NORTH | Land::WEST))
-        return false;
-
-    return true;
-}
-
-int scoreIfDestroyed(Land type) {
-    using enum Land;
-
-    switch (type & ~MODIFIED & ~BADLAND) {
-    case HOUSE       : return -10;
-    case FIELD       : return -10;
-    case PLAYER_FLAG : return -30;
-    case ENEMY_FLAG  : return 100;
-    case AIRDROME    : return 100;
-    default          : return   0;
-    }
-}
@@ -19,6 +19,7 @@ If not, see <https://www.gnu.org/licenses/>. */
 #include <string>
 #include <concepts>
 #include <compare>
+#include <array>
 #include <bit>
 #include <cstdint>
 
@@ -101,38 +102,57 @@ inline constexpr bool test(Land lhs, Land rhs) noexcept {
     return static_cast<bool>(lhs & rhs);
 }
 
-bool isModifiable(Land land) noexcept;
+// properties of a single tile variant, see LAND_PROPERTIES
+struct LandProperties {
+    bool valid;
+    bool modifiable;
+    bool badlandVariant;
+    Land waterAnySides; // sides for which hasWaterAny is true
+    int8_t scoreIfDestroyed;
+};
+
+// indexed by Land, generated at compile time from the rules in Land.cpp
+extern const std::array<LandProperties, LAND_VARIANTS> LAND_PROPERTIES;
+
+inline const LandProperties& getProperties(Land land) noexcept {
+    return LAND_PROPERTIES[static_cast<std::underlying_type_t<Land>>(land)];
+}
+
+inline bool isModifiable(Land land) noexcept {
+    return getProperties(land).modifiable;
+}
 
 inline bool hasBadlandVariant(Land land) noexcept {
-    return land != (Land::FEATURE | Land::BUSH) 
-        && land != Land::WATER;
+    return getProperties(land).badlandVariant;
 }
 
-bool isValid(Land land) noexcept;
+inline bool isValid(Land land) noexcept {
+    return getProperties(land).valid;
+}
 
 // number of roads leaving the tile / number of shores
 // WARNING: unsafe, use only if (*this & ROAD) || (*this & WATER)
-inline int getActiveDirCount(Land land) noexcept {
+inline constexpr int getActiveDirCount(Land land) noexcept {
     using Base = std::underlying_type_t<Land>;
     return std::popcount(static_cast<Base>(land & Land::DIR_MASK));
 }
 
 // WARNING: side must be a single dir flag
 // e. g. it must be one of NORTH, EAST, SOUTH, WEST
-inline bool hasRoadSide(Land land, Land side) noexcept {
+inline constexpr bool hasRoadSide(Land land, Land side) noexcept {
     return test(land, Land::ROAD) && test(land, side);
 }
 
 // WARNING: side must be a single dir flag
 // e. g. it must be one of NORTH, EAST, SOUTH, WEST
-inline bool hasWaterSide(Land land, Land side) noexcept {
+inline constexpr bool hasWaterSide(Land land, Land side) noexcept {
     return test(land, Land::WATER) && (!test(land, Land::DIR_MASK) 
                                     || !test(land, Land::MODIFIED) && test(land, side));
 }
 
 // WARNING: corner must be a combination of two dir flags that form a corner
 // e. g. sit must be one of NORTH | EAST, NORTH | WEST, SOUTH | EAST, SOUTH | WEST
-inline bool hasWaterCorner(Land land, Land corner) noexcept {
+inline constexpr bool hasWaterCorner(Land land, Land corner) noexcept {
     return test(land, Land::WATER) && (  !test(land,  Land::DIR_MASK) 
                                        || test(land, corner) && !test(land,  Land::MODIFIED) 
                                        || (land & Land::DIR_MASK) == corner);
@@ -141,7 +161,9 @@ inline bool hasWaterCorner(Land land, Land corner) noexcept {
 // true if has water on this side or to adjenct corners
 // WARNING: side must be a single dir flag
 // e. g. it must be one of NORTH, EAST, SOUTH, WEST
-bool hasWaterAny(Land land, Land side) noexcept;
+inline bool hasWaterAny(Land land, Land side) noexcept {
+    return test(getProperties(land).waterAnySides, side);
+}
 
 // only file name, add path to search by yourself
 std::filesystem::path getTextureFileName(Land land);
@@ -193,17 +215,41 @@ void forValidLand(Fn&& f) {
     forValidWater(std::forward<Fn>(f));
 }
 
+// bit matrix indexed by two Land values
+// generated at compile time from the rules in Land.cpp
+using LandCompatabilityMatrix = std::array<std::array<uint64_t, LAND_VARIANTS / 64>, LAND_VARIANTS>;
+
+extern const LandCompatabilityMatrix LAND_COMPATABLE_HORIZONTAL;
+extern const LandCompatabilityMatrix LAND_COMPATABLE_VERTICAL;
+extern const LandCompatabilityMatrix LAND_COMPATABLE_DIAGONAL;
+extern const LandCompatabilityMatrix LAND_COMPATABLE_ANTI_DIAGONAL;
+
+inline constexpr bool isCompatable(const LandCompatabilityMatrix& matrix, 
+                                   Land first, Land second) noexcept {
+    using Base = std::underlying_type_t<Land>;
+    Base secondIndex = static_cast<Base>(second);
+    return (matrix[static_cast<Base>(first)][secondIndex / 64] >> (secondIndex % 64)) & 1;
+}
+
 // true if it's valid to place the left tile next to the right tile (in horizontal row)
-bool isCompatableHorizontal(Land left, Land right);
+inline bool isCompatableHorizontal(Land left, Land right) noexcept {
+    return isCompatable(LAND_COMPATABLE_HORIZONTAL, left, right);
+}
 
 // true if it's valid to place the up tile next to the down tile (in vertical row)
-bool isCompatableVertical(Land up, Land down);
+inline bool isCompatableVertical(Land up, Land down) noexcept {
+    return isCompatable(LAND_COMPATABLE_VERTICAL, up, down);
+}
 
 // true if it's valid to place the upLeft tile next to the downRight tile (in diagonal manner)
-bool isCompatableDiagonal(Land upLeft, Land downRight);
+inline bool isCompatableDiagonal(Land upLeft, Land downRight) noexcept {
+    return isCompatable(LAND_COMPATABLE_DIAGONAL, upLeft, downRight);
+}
 
 // true if it's valid to place the downLeft tile next to the upRight tile (in anti-diagonal manner)
-bool isCompatableAntiDiagonal(Land downLeft, Land upRight);
+inline bool isCompatableAntiDiagonal(Land downLeft, Land upRight) noexcept {
+    return isCompatable(LAND_COMPATABLE_ANTI_DIAGONAL, downLeft, upRight);
+}
 
 inline Land destroyed(Land land) noexcept {
     if (test(land, Land::WATER) || test(land, Land::ROAD))
@@ -211,7 +257,9 @@ inline Land destroyed(Land land) noexcept {
     return Land::CRATER | land & Land::BADLAND;
 }
 
-int scoreIfDestroyed(Land land);
+inline int scoreIfDestroyed(Land land) noexcept {
+    return getProperties(land).scoreIfDestroyed;
+}
 
 inline bool isEnemyTarget(Land land) noexcept {
     return (land & ~Land::MODIFIED & ~Land::BADLAND) == Land::PLAYER_FLAG;
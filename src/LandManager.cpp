@@ -22,10 +22,17 @@ If not, see <https://www.gnu.org/licenses/>. */
 #include <random>
 #include <ranges>
 #include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
 
-LandManager::LandManager(GameState& gameState) noexcept : m_gameState{gameState} {}
+LandManager::LandManager(GameState& gameState) noexcept : 
+    m_firstColumn{0}, m_journalEpoch{0}, m_nextJournalEpoch{1}, m_nextChangeId{1}, m_layerColumns{0}, m_layerBegin{0}, m_layerEnd{0}, m_drawStats{0, 0}, m_gameState{gameState} {}
 
 void LandManager::init() {
+    m_randomEngine.seed(m_gameState.getRandomEngine()());
+
     prepareChances();
     startSpawnGeneration();
 }
@@ -70,10 +77,11 @@ void LandManager::startSpawnGeneration() {
     auto tileSize = m_gameState.getAssets().getLandTextureSize();
 
     m_land.emplace_back();
+    m_targetRows.push_back(0);
     m_endX = -m_gameState.getGameHeight() / 2;
 
     float y = -m_gameState.getGameHeight() / 2;
-    addTile(ChanceTable::getRandom(m_chances, m_gameState.getRandomEngine()));
+    addTile(ChanceTable::getRandom(m_chances, m_randomEngine));
     y += tileSize.y;
 
     while (y < m_gameState.getGameHeight() / 2) {
@@ -84,7 +92,7 @@ void LandManager::startSpawnGeneration() {
                         (const auto& entry) -> bool {
                             return isCompatableVertical(up, value(entry));
                 })  | ChanceTable::views::normalize, 
-            m_gameState.getRandomEngine()));
+            m_randomEngine));
         y += tileSize.y;
     }
 }
@@ -97,18 +105,20 @@ void LandManager::update() {
     float playerX = m_gameState.getEntities().getPlayerPosition().x;
     while (playerX + 5 * m_gameState.getGameHeight() >= m_endX) {
         m_land.pop_front();
+        m_targetRows.pop_front();
+        ++ m_firstColumn;
         addRow();
     }
 
-    auto tileSize = m_gameState.getAssets().getLandTextureSize();
-    std::erase_if(m_targets, 
-    [minX = m_endX - std::ssize(m_land) * tileSize.x](sf::Vector2f target) -> bool {
-        return target.x <= minX;
+    // changes of scrolled out columns are never undone, restore copies these columns
+    std::erase_if(m_journal, [this](const TileChange& change) {
+        return change.column < m_firstColumn;
     });
 }
 
 void LandManager::addRow() {
     m_land.emplace_back();
+    m_targetRows.push_back(0);
     const auto& prevRow = m_land[std::ssize(m_land) - 2];
     auto& row = m_land.back();
     row.reserve(std::ssize(prevRow));
@@ -122,7 +132,7 @@ void LandManager::addRow() {
                     return isCompatableHorizontal(left, value(entry))
                         && isCompatableAntiDiagonal(downLeft, value(entry));
             })  | ChanceTable::views::normalize, 
-        m_gameState.getRandomEngine()));
+        m_randomEngine));
 
     while (std::ssize(row) < std::ssize(prevRow) - 1)
         addTile(ChanceTable::getRandom(
@@ -138,7 +148,7 @@ void LandManager::addRow() {
                             && isCompatableDiagonal    (upLeft  , value(entry))
                             && isCompatableAntiDiagonal(downLeft, value(entry));
                 })  | ChanceTable::views::normalize, 
-            m_gameState.getRandomEngine()));
+            m_randomEngine));
 
     row.push_back(ChanceTable::getRandom(
             m_chances 
@@ -151,16 +161,86 @@ void LandManager::addRow() {
                             && isCompatableHorizontal(left  , value(entry))
                             && isCompatableDiagonal  (upLeft, value(entry));
             })  | ChanceTable::views::normalize, 
-        m_gameState.getRandomEngine()));
+        m_randomEngine));
     
     m_endX += m_gameState.getAssets().getLandTextureSize().x;
 }
 
 void LandManager::reset() {
     m_land.clear();
+    m_targetRows.clear();
+
+    m_layerBegin = m_layerEnd = m_firstColumn;
+    m_dirtyTiles.clear();
+
+    m_journal.clear();
+    m_journalEpoch = m_nextJournalEpoch++;
+
     startSpawnGeneration();
 }
 
+LandManager::Snapshot LandManager::getSnapshot() const {
+    return {m_land, m_targetRows, m_endX, m_randomEngine, 
+            m_firstColumn, m_journalEpoch, m_nextChangeId - 1};
+}
+
+void LandManager::restore(const Snapshot& snapshot) {
+    int64_t snapshotEnd = snapshot.firstColumn + std::ssize(snapshot.land);
+    bool journalValid = snapshot.journalEpoch == m_journalEpoch
+                     && snapshot.firstColumn <= m_firstColumn 
+                     && m_firstColumn < snapshotEnd;
+
+    if (journalValid) {
+        while (!m_journal.empty() && m_journal.back().id > snapshot.lastChangeId) {
+            const TileChange& change = m_journal.back();
+
+            int column = static_cast<int>(change.column - m_firstColumn);
+            m_land[column][change.row] = change.before;
+            if (isEnemyTarget(change.before))
+                m_targetRows[column] |= uint64_t{1} << change.row;
+            markDirty(change.column, change.row);
+
+            m_journal.pop_back();
+        }
+
+        bool scrolled = snapshot.firstColumn != m_firstColumn;
+
+        // columns generated after the snapshot
+        while (m_firstColumn + std::ssize(m_land) > snapshotEnd) {
+            m_land.pop_back();
+            m_targetRows.pop_back();
+        }
+
+        // columns scrolled out after the snapshot
+        while (m_firstColumn > snapshot.firstColumn) {
+            -- m_firstColumn;
+            m_land.push_front(snapshot.land[m_firstColumn - snapshot.firstColumn]);
+            m_targetRows.push_front(snapshot.targetRows[m_firstColumn - snapshot.firstColumn]);
+        }
+
+        m_endX = snapshot.endX;
+        m_randomEngine = snapshot.randomEngine;
+
+        if (scrolled) {
+            m_layerBegin = m_layerEnd = m_firstColumn;
+            m_dirtyTiles.clear();
+        }
+    } else {
+        m_land = snapshot.land;
+        m_targetRows = snapshot.targetRows;
+        m_endX = snapshot.endX;
+        m_randomEngine = snapshot.randomEngine;
+        m_firstColumn = snapshot.firstColumn;
+
+        m_layerBegin = m_layerEnd = m_firstColumn;
+        m_dirtyTiles.clear();
+    }
+
+    // snapshots taken after this one don't describe the new history
+    m_journal.clear();
+    m_journalEpoch = m_nextJournalEpoch++;
+}
+
 bool LandManager::isXValid(float x) const noexcept {
     auto tileSize = m_gameState.getAssets().getLandTextureSize();
     return x < m_endX && x > m_endX - std::ssize(m_land) * tileSize.x;
@@ -173,50 +253,161 @@ sf::Vector2i LandManager::toIndices(sf::Vector2f position) const noexcept {
                         (m_gameState.getGameHeight() / 2 + position.y) / tileSize.y);
 }
 
+sf::Vector2f LandManager::getTileCenter(int column, int row) const noexcept {
+    auto tileSize = m_gameState.getAssets().getLandTextureSize();
+    return {m_endX - (std::ssize(m_land) - column) * tileSize.x + tileSize.x / 2.f, 
+            row * tileSize.y - m_gameState.getGameHeight() / 2.f + tileSize.y / 2.f};
+}
+
 void LandManager::handleBombExplosion(sf::Vector2f position) {  
     if (!isXValid(position.x)) return;     
-    Land& land = (*this)[position];
+    auto [x, y] = toIndices(position);
+    Land& land = m_land[x][y];
+    m_journal.push_back({m_firstColumn + x, y, land, m_nextChangeId++});
+
     m_gameState.getScoreManager().addScore(scoreIfDestroyed(land));
     land = destroyed(land);
+    if (!m_gameState.isHeadless())
+        m_gameState.getAssets().prefetchLandTexture(land);
+
+    if (!isEnemyTarget(land))
+        m_targetRows[x] &= ~(uint64_t{1} << y);
+
+    markDirty(m_firstColumn + x, y);
+}
+
+void LandManager::markDirty(int64_t column, int row) {
+    if (!m_gameState.isHeadless())
+        m_dirtyTiles.emplace_back(column, row);
 }
 
 void LandManager::draw(sf::RenderTarget& target, sf::RenderStates states) const {
-    auto textureSize = m_gameState.getAssets().getLandTextureSize();
-    float playerX = m_gameState.getEntities().getPlayerPosition().x;
-    float gameHeight = m_gameState.getGameHeight();
+    auto tileSize = m_gameState.getAssets().getLandTextureSize();
+    sf::View view = target.getView();
+
+    float landLeft = m_endX - std::ssize(m_land) * tileSize.x;
+    float viewLeft  = view.getCenter().x - view.getSize().x / 2.f;
+    float viewRight = view.getCenter().x + view.getSize().x / 2.f;
+
+    auto begin = static_cast<int64_t>(std::floor((viewLeft  - landLeft) / tileSize.x));
+    auto end   = static_cast<int64_t>(std::ceil ((viewRight - landLeft) / tileSize.x));
+    begin = std::clamp<int64_t>(begin, 0, std::ssize(m_land));
+    end   = std::clamp<int64_t>(end, begin, std::ssize(m_land));
+
+    int visibleColumns = static_cast<int>(std::ceil(view.getSize().x / tileSize.x)) + 1;
+    if (m_layerColumns < visibleColumns) {
+        if (!m_layer.create(visibleColumns * tileSize.x, std::ssize(m_land[0]) * tileSize.y))
+            throw TextureLoadError{"Can't create land layer texture"};
+        m_layerColumns = visibleColumns;
+        m_layerBegin = m_layerEnd = m_firstColumn;
+    }
+
+    updateLayer(m_firstColumn + begin, m_firstColumn + end);
+    drawLayer(target, states, m_firstColumn + begin, m_firstColumn + end);
+
+    auto rows = static_cast<int>(std::ssize(m_land[0]));
+    m_drawStats.drawn  = static_cast<int>(end - begin) * rows;
+    m_drawStats.culled = static_cast<int>(std::ssize(m_land) - (end - begin)) * rows;
+}
+
+void LandManager::updateLayer(int64_t begin, int64_t end) const {
+    for (int64_t column = begin; column < end; ++ column)
+        if (column < m_layerBegin || column >= m_layerEnd)
+            for (int row = 0; row < std::ssize(m_land[column - m_firstColumn]); ++ row)
+                renderTile(static_cast<int>(column - m_firstColumn), row);
+
+    for (auto [column, row] : m_dirtyTiles)
+        if (column >= std::max(begin, m_layerBegin) && column < std::min(end, m_layerEnd))
+            renderTile(static_cast<int>(column - m_firstColumn), row);
+    m_dirtyTiles.clear();
+
+    m_layerBegin = begin;
+    m_layerEnd = end;
+    m_layer.display();
+}
 
-    sf::Vector2f start{playerX - gameHeight / 2 - std::fmodf(playerX, textureSize.x), 
-                        -gameHeight / 2};
-    for (int ix = 0; start.x + ix * textureSize.x < playerX + 4 * gameHeight; ++ ix)
-        for (float iy = 0; iy < std::ssize(m_land[ix]); ++ iy) {
-            sf::Sprite sprite{m_gameState.getAssets().getLandTexture(m_land[ix][iy])};
-            sprite.setPosition(start.x + ix * textureSize.x, start.y + iy * textureSize.y);
-            target.draw(sprite, states);
+void LandManager::renderTile(int column, int row) const {
+    auto tileSize = m_gameState.getAssets().getLandTextureSize();
+    
+    sf::Sprite sprite{m_gameState.getAssets().getLandTexture(m_land[column][row])};
+    sprite.setPosition(((m_firstColumn + column) % m_layerColumns) * tileSize.x, row * tileSize.y);
+    m_layer.draw(sprite, sf::BlendNone);
+}
+
+void LandManager::drawLayer(sf::RenderTarget& target, sf::RenderStates states, 
+                            int64_t begin, int64_t end) const {
+    auto tileSize = m_gameState.getAssets().getLandTextureSize();
+    float landLeft = m_endX - std::ssize(m_land) * tileSize.x;
+    float top = -m_gameState.getGameHeight() / 2.f;
+    float height = static_cast<float>(m_layer.getSize().y);
+
+    // slots of [begin, end) are continuous except one wrap around the end of m_layer
+    sf::VertexArray quads{sf::Quads};
+    while (begin < end) {
+        int64_t slot = begin % m_layerColumns;
+        int64_t runEnd = std::min(end, begin + m_layerColumns - slot);
+
+        float left  = landLeft + (begin  - m_firstColumn) * tileSize.x;
+        float right = landLeft + (runEnd - m_firstColumn) * tileSize.x;
+        float texLeft  = static_cast<float>(slot * tileSize.x);
+        float texRight = static_cast<float>((slot + runEnd - begin) * tileSize.x);
+
+        quads.append({{left , top         }, {texLeft , 0.f   }});
+        quads.append({{right, top         }, {texRight, 0.f   }});
+        quads.append({{right, top + height}, {texRight, height}});
+        quads.append({{left , top + height}, {texLeft , height}});
+
+        begin = runEnd;
     }
+
+    states.texture = &m_layer.getTexture();
+    target.draw(quads, states);
 }
 
 sf::Vector2f LandManager::getTargetFor(sf::Vector2f enemyPosition) noexcept {    
-    auto maxIter = std::ranges::upper_bound(m_targets, enemyPosition.x, {}, &sf::Vector2f::x);
-    int maxIndex = (maxIter - m_targets.begin()) - 1;
+    // only targets that aren't behind the enemy
+    auto tileSize = m_gameState.getAssets().getLandTextureSize();
+    float firstCenterX = getTileCenter(0, 0).x;
+    int columns = std::clamp(static_cast<int>(std::floor((enemyPosition.x - firstCenterX) / tileSize.x)) + 1, 
+                             0, static_cast<int>(std::ssize(m_targetRows)));
+
+    int targetCount = 0;
+    for (int column = 0; column < columns; ++ column)
+        targetCount += std::popcount(m_targetRows[column]);
 
-    if (maxIndex < 0)
+    if (targetCount == 0)
         return enemyPosition;
 
-    int index = std::uniform_int_distribution{0, maxIndex}(m_gameState.getRandomEngine());
-    return m_targets[index];
+    int index = std::uniform_int_distribution{0, targetCount - 1}(m_gameState.getRandomEngine());
+    for (int column = 0;; ++ column) {
+        uint64_t rows = m_targetRows[column];
+        if (index < std::popcount(rows)) {
+            for (; index > 0; -- index)
+                rows &= rows - 1;
+            return getTileCenter(column, std::countr_zero(rows));
+        }
+        index -= std::popcount(rows);
+    }
 }
 
 void LandManager::addTile(Land land) {
     auto tileSize = m_gameState.getAssets().getLandTextureSize();
     float gameHeight = m_gameState.getGameHeight();
 
+    // row count depends on game height and tile size so it's only known at runtime
+    if (std::ssize(m_land.back()) >= std::numeric_limits<uint64_t>::digits)
+        throw std::length_error{"Too many land rows, target rows don't fit in bitmask"};
+
     m_land.back().push_back(land);
+    // nothing is drawn in headless games
+    if (!m_gameState.isHeadless())
+        m_gameState.getAssets().prefetchLandTexture(land);
 
     sf::Vector2f position{m_endX + tileSize.x / 2.f, 
         (std::ssize(m_land.back()) - 1) * tileSize.y - gameHeight / 2.f + tileSize.y / 2.f};
     
     if (isEnemyTarget(land))
-        m_targets.push_back(position);
+        m_targetRows.back() |= uint64_t{1} << (std::ssize(m_land.back()) - 1);
     
     if (canHaveTurret(land))
         m_gameState.getEntities().trySpawnTurret(position);
@@ -19,10 +19,15 @@ If not, see <https://www.gnu.org/licenses/>. */
 #include "declarations.h"
 
 #include "ChanceTableEntry.h"
+#include "DrawStats.h"
 
 #include <SFML/Graphics.hpp>
 
 #include <deque>
+#include <vector>
+#include <random>
+#include <utility>
+#include <cstdint>
 
 class LandManager : public sf::Drawable {
 public:
@@ -34,8 +39,27 @@ public:
 
     void update();
 
+    // generate land from scratch
     void reset();
 
+    struct Snapshot {
+        std::deque<std::vector<Land>> land;
+        std::deque<uint64_t> targetRows;
+        float endX;
+        std::mt19937_64 randomEngine;
+
+        int64_t firstColumn;
+        int64_t journalEpoch;
+        int64_t lastChangeId; // changes with greater id were made after the snapshot
+    };
+
+    Snapshot getSnapshot() const;
+
+    // if the journal reaches back to the snapshot, changes after it are undone
+    // and only columns scrolled out since it are copied
+    // otherwise the whole snapshot is copied
+    void restore(const Snapshot& snapshot);
+
     Land& operator[] (sf::Vector2f position) noexcept {
         auto [x, y] = toIndices(position);
         return m_land[x][y];
@@ -53,6 +77,11 @@ public:
 
     bool isLoading() const;
 
+    // of the last draw, in tiles
+    DrawStats getDrawStats() const noexcept {
+        return m_drawStats;
+    }
+
     void load() {
         addRow();
     }
@@ -60,8 +89,38 @@ private:
     std::deque<std::vector<Land>> m_land;
     float m_endX;
 
-    // targets are sorted by X
-    std::vector<sf::Vector2f> m_targets;
+    // bitmask of rows with enemy targets for every column in m_land
+    std::deque<uint64_t> m_targetRows;
+
+    // number of columns popped from m_land since start, absolute index of m_land[0]
+    int64_t m_firstColumn;
+
+    // land generation has own engine so generated land depends only on its state
+    std::mt19937_64 m_randomEngine;
+
+    // tiles of columns in m_land changed since land was last reset or restored
+    struct TileChange {
+        int64_t column; // absolute
+        int row;
+        Land before;
+        int64_t id;
+    };
+    std::vector<TileChange> m_journal;
+    // changes when m_journal is cleared, snapshots with other epoch can't be restored with it
+    // ids of changes only grow so entries are sorted by id
+    int64_t m_journalEpoch;
+    int64_t m_nextJournalEpoch;
+    int64_t m_nextChangeId;
+
+    // rendered land, column with absolute index i is stored in slot i % m_layerColumns
+    mutable sf::RenderTexture m_layer;
+    mutable int m_layerColumns;
+    // absolute indices of columns rendered into m_layer
+    mutable int64_t m_layerBegin;
+    mutable int64_t m_layerEnd;
+    // tiles changed after they were rendered, absolute column and row
+    mutable std::vector<std::pair<int64_t, int>> m_dirtyTiles;
+    mutable DrawStats m_drawStats;
 
     std::vector<ChanceTable::BasicEntry<Land>> m_chances;
     const static std::array<double, 5> s_roadChances ; // index is activeDirCount
@@ -80,11 +139,21 @@ private:
     void addTile(Land land);
     void addRow();
 
+    // headless worlds are never drawn so tiles aren't tracked there
+    void markDirty(int64_t column, int row);
+
     void startSpawnGeneration();
 
+    // only columns inside the view are drawn
     void draw(sf::RenderTarget& target, sf::RenderStates states) const;
 
+    // render columns [begin, end) (absolute indices) into m_layer if they aren't there yet
+    void updateLayer(int64_t begin, int64_t end) const;
+    void renderTile(int column, int row) const;
+    void drawLayer(sf::RenderTarget& target, sf::RenderStates states, int64_t begin, int64_t end) const;
+
     sf::Vector2i toIndices(sf::Vector2f position) const noexcept;
+    sf::Vector2f getTileCenter(int column, int row) const noexcept;
 };
 
 #endif
\ No newline at end of file
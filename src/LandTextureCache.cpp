@@ -0,0 +1,134 @@
+/* This file is part of Jutchs Shmup.
+
+Jutchs Shmup is free software: you can redistribute it and/or modify it 
+under the terms of the GNU General Public License as published by the Free Software Foundation, 
+either version 3 of the License, or (at your option) any later version.
+
+Jutchs Shmup is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with Jutchs Shmup. 
+If not, see <https://www.gnu.org/licenses/>. */
+
+#include "LandTextureCache.h"
+
+#include "AssetManager.h"
+
+#include <format>
+#include <utility>
+#include <filesystem>
+
+namespace {
+    std::filesystem::path getPath(Land land) {
+        return "resources/textures/Land/" / getTextureFileName(land);
+    }
+}
+
+LandTextureCache::LandTextureCache() : m_states{}, 
+    m_decodeThread{[this](std::stop_token stopToken) {
+        runDecode(stopToken);
+    }} {
+    // variants are decoded only when they appear, missing files would fail mid-game
+    checkFiles();
+}
+
+void LandTextureCache::checkFiles() {
+    forValidLand([](Land land) {
+        if (!std::filesystem::is_regular_file(getPath(land)))
+            throw TextureLoadError{std::format("Can't find {} tile texture", getName(land))};
+    });
+}
+
+void LandTextureCache::prefetch(Land land) {
+    std::scoped_lock lock{m_mutex};
+
+    State& state = m_states[index(land)];
+    if (state != State::NOT_LOADED) return;
+
+    state = State::QUEUED;
+    m_queue.push_back(land);
+    m_queued.notify_one();
+}
+
+const sf::Texture& LandTextureCache::get(Land land) {
+    int i = index(land);
+    std::unique_ptr<sf::Image> image;
+    {
+        std::scoped_lock lock{m_mutex};
+        switch (m_states[i]) {
+        case State::LOADED:
+            return m_textures[i];
+        case State::FAILED:
+            std::rethrow_exception(m_errors[i]);
+        case State::DECODED:
+            image = std::move(m_images[i]);
+            break;
+        default:
+            // queued variants aren't waited for, decoder drops them after this
+            break;
+        }
+        m_states[i] = State::DECODING;
+    }
+
+    // decoded without the lock so prefetch and the decoder aren't blocked
+    if (!image) {
+        try {
+            image = decode(land);
+        } catch (const TextureLoadError&) {
+            std::scoped_lock lock{m_mutex};
+            m_errors[i] = std::current_exception();
+            m_states[i] = State::FAILED;
+            throw;
+        }
+    }
+
+    std::scoped_lock lock{m_mutex};
+    if (m_states[i] == State::LOADED)
+        return m_textures[i];
+
+    if (!m_textures[i].loadFromImage(*image)) {
+        m_states[i] = State::NOT_LOADED;
+        throw TextureLoadError{std::format("Can't load {} tile texture", getName(land))};
+    }
+
+    m_states[i] = State::LOADED;
+    return m_textures[i];
+}
+
+void LandTextureCache::runDecode(std::stop_token stopToken) {
+    std::unique_lock lock{m_mutex};
+    while (m_queued.wait(lock, stopToken, [this] { return !m_queue.empty(); })) {
+        Land land = m_queue.front();
+        m_queue.pop_front();
+
+        lock.unlock();
+        std::unique_ptr<sf::Image> image;
+        std::exception_ptr error;
+        try {
+            image = decode(land);
+        } catch (const TextureLoadError&) {
+            // rethrown by get on the drawing thread
+            error = std::current_exception();
+        }
+        lock.lock();
+
+        State& state = m_states[index(land)];
+        if (state != State::QUEUED) continue;
+
+        if (image) {
+            m_images[index(land)] = std::move(image);
+            state = State::DECODED;
+        } else {
+            m_errors[index(land)] = error;
+            state = State::FAILED;
+        }
+    }
+}
+
+std::unique_ptr<sf::Image> LandTextureCache::decode(Land land) {
+    auto image = std::make_unique<sf::Image>();
+    if (!image->loadFromFile(getPath(land).generic_string()))
+        throw TextureLoadError{std::format("Can't load {} tile texture", getName(land))};
+    return image;
+}
@@ -0,0 +1,84 @@
+/* This file is part of Jutchs Shmup.
+
+Jutchs Shmup is free software: you can redistribute it and/or modify it 
+under the terms of the GNU General Public License as published by the Free Software Foundation, 
+either version 3 of the License, or (at your option) any later version.
+
+Jutchs Shmup is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with Jutchs Shmup. 
+If not, see <https://www.gnu.org/licenses/>. */
+
+#ifndef LAND_TEXTURE_CACHE_H_
+#define LAND_TEXTURE_CACHE_H_
+
+#include "Land.h"
+
+#include <SFML/Graphics.hpp>
+
+#include <array>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <stop_token>
+#include <exception>
+#include <cstdint>
+
+// land tile textures loaded the first time they are needed
+// files of prefetched variants are decoded by a background thread
+// and only uploaded when drawn
+// files of all valid variants are checked to exist on construction
+class LandTextureCache {
+public:
+    LandTextureCache();
+
+    LandTextureCache(const LandTextureCache&) = delete;
+    LandTextureCache& operator = (const LandTextureCache&) = delete;
+
+    // queue decoding of the file, does nothing if it's already queued or loaded
+    // may be called from any thread
+    void prefetch(Land land);
+
+    // load the texture if it isn't loaded yet
+    // must be called from the drawing thread
+    // throws TextureLoadError if the file can't be decoded, even if it failed on the decoder thread
+    const sf::Texture& get(Land land);
+private:
+    enum class State : uint8_t {
+        NOT_LOADED, 
+        QUEUED, 
+        DECODING, // by get
+        DECODED, 
+        LOADED, 
+        FAILED
+    };
+
+    std::mutex m_mutex;
+    std::condition_variable_any m_queued;
+
+    std::deque<Land> m_queue;
+    std::array<State, LAND_VARIANTS> m_states;
+    std::array<std::unique_ptr<sf::Image>, LAND_VARIANTS> m_images; // only for DECODED variants
+    std::array<std::exception_ptr, LAND_VARIANTS> m_errors; // only for FAILED variants
+
+    // address of a texture never changes so sprites can keep it
+    std::array<sf::Texture, LAND_VARIANTS> m_textures;
+
+    // declared last so it's joined before everything it uses is destroyed
+    std::jthread m_decodeThread;
+
+    void runDecode(std::stop_token stopToken);
+
+    static std::unique_ptr<sf::Image> decode(Land land);
+    static void checkFiles();
+
+    static int index(Land land) noexcept {
+        return static_cast<std::underlying_type_t<Land>>(land);
+    }
+};
+
+#endif
@@ -0,0 +1,87 @@
+/* This file is part of Jutchs Shmup.
+
+Jutchs Shmup is free software: you can redistribute it and/or modify it
+under the terms of the GNU General Public License as published by the Free Software Foundation,
+either version 3 of the License, or (at your option) any later version.
+
+Jutchs Shmup is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with Jutchs Shmup.
+If not, see <https://www.gnu.org/licenses/>. */
+
+#ifndef LOCK_FREE_QUEUE_H_
+#define LOCK_FREE_QUEUE_H_
+
+#include <array>
+#include <atomic>
+#include <optional>
+#include <stop_token>
+#include <cstddef>
+#include <cstdint>
+#include <concepts>
+#include <type_traits>
+
+// bounded queue for exactly one producer thread and one consumer thread
+template <std::default_initializable T, size_t capacity> 
+    requires std::is_trivially_copyable_v<T>
+class LockFreeQueue {
+public:
+    LockFreeQueue() noexcept : m_head{0}, m_tail{0}, m_signal{0} {}
+
+    // producer only
+    // return false if queue is full
+    bool push(T value) noexcept {
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_head.load(std::memory_order_acquire) == capacity)
+            return false;
+
+        m_items[tail % capacity] = value;
+        m_tail.store(tail + 1, std::memory_order_release);
+        signal();
+        return true;
+    }
+
+    // consumer only
+    std::optional<T> pop() noexcept {
+        size_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_tail.load(std::memory_order_acquire))
+            return std::nullopt;
+
+        T value = m_items[head % capacity];
+        m_head.store(head + 1, std::memory_order_release);
+        return value;
+    }
+
+    // consumer only
+    // block until something is pushed or wakeConsumer is called
+    // stop must be requested before wakeConsumer is called for it
+    void waitForItems(const std::stop_token& stopToken) const noexcept {
+        // push or wakeConsumer after this load changes m_signal so wait can't miss it
+        uint32_t signal = m_signal.load(std::memory_order_acquire);
+        // wakeConsumer before the load is seen through the token instead
+        if (stopToken.stop_requested()) return;
+
+        if (m_head.load(std::memory_order_relaxed) == m_tail.load(std::memory_order_acquire))
+            m_signal.wait(signal, std::memory_order_acquire);
+    }
+
+    // wake consumer blocked in waitForItems without pushing anything
+    void wakeConsumer() noexcept {
+        signal();
+    }
+private:
+    std::array<T, capacity> m_items;
+
+    alignas(64) std::atomic<size_t> m_head;
+    alignas(64) std::atomic<size_t> m_tail;
+    alignas(64) std::atomic<uint32_t> m_signal;
+
+    void signal() noexcept {
+        m_signal.fetch_add(1, std::memory_order_release);
+        m_signal.notify_one();
+    }
+};
+
+#endif
@@ -17,6 +17,7 @@ If not, see <https://www.gnu.org/licenses/>. */
 #include "Entity.h"
 #include "Airplane/Airplane.h"
 #include "GameState.h"
+#include "algorithm.h"
 
 #include <SFML/Graphics.hpp>
 #include <SFML/System.hpp>
@@ -29,6 +30,10 @@ public:
 
     void update(sf::Time) noexcept override {}
 
+    bool isUpdatedInParallel() const noexcept override {
+        return true;
+    }
+
     void acceptCollide(Airplane::Airplane& other) noexcept override {
         if (other.canUsePickups()) 
             apply(other);
@@ -54,10 +59,15 @@ public:
 
     void apply(Airplane::Airplane& airplane) noexcept override {
         if (airplane.tryHeal()) {
-            m_gameState.getSounds().addSound(m_gameState.getAssets().getRandomPowerUpSound());
+            auto& sound = random_element(m_gameState.getAssets().getPowerUpSounds(), m_gameState.getRandomEngine());
+            m_gameState.getSounds().addSoundAt(sound, getPosition().x, SoundManager::HIGH_PRIORITY);
             die();
         }
     };
+
+    std::unique_ptr<Entity> clone() const override {
+        return std::make_unique<HealthPickup>(*this);
+    }
 };
 
 class BombPickup : public Pickup {
@@ -67,10 +77,15 @@ public:
 
     void apply(Airplane::Airplane& airplane) noexcept override {
         if (airplane.tryAddBomb()) {
-            m_gameState.getSounds().addSound(m_gameState.getAssets().getRandomPowerUpSound());
+            auto& sound = random_element(m_gameState.getAssets().getPowerUpSounds(), m_gameState.getRandomEngine());
+            m_gameState.getSounds().addSoundAt(sound, getPosition().x, SoundManager::HIGH_PRIORITY);
             die();
         }
     };
+
+    std::unique_ptr<Entity> clone() const override {
+        return std::make_unique<BombPickup>(*this);
+    }
 };
 
 #endif
\ No newline at end of file
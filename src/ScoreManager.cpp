@@ -17,8 +17,6 @@ If not, see <https://www.gnu.org/licenses/>. */
 
 #include "Airplane/Airplane.h"
 
-#include "Gui/drawNumber.h"
-
 #include <fstream>
 #include <utility>
 
@@ -26,13 +24,14 @@ const sf::Time SCORE_CHANGE_APPLY_DELAY = sf::seconds(0.5f);
 const sf::Time SCORE_CHANGE_APPLY_TIME = sf::seconds(0.5f);
 
 ScoreManager::ScoreManager(GameState& gameState) noexcept : 
-        m_score{0}, m_scoredX{0.f}, m_gameState{gameState}, m_scoreChange{0}, 
+        m_score{0}, m_bestScore{0.f}, m_scoredX{0.f}, m_gameState{gameState}, m_scoreChange{0}, 
         m_changeApplySpeed{0.0f}, m_changeApplyStart{sf::Time::Zero} {
+    // parallel headless games would race on the file
+    if (m_gameState.isHeadless()) return;
+
     std::ifstream best_score_file{"best_score.txt"};
     if (best_score_file)
         best_score_file >> m_bestScore;
-    else
-        m_bestScore = 0.f;
 }
 
 void ScoreManager::addScore(float score) noexcept {
@@ -61,11 +60,22 @@ void ScoreManager::update(sf::Time elapsedTime) {
 
 void ScoreManager::saveBestScore() noexcept {
     m_bestScore = std::max(m_score + m_scoreChange, m_bestScore);
+    if (m_gameState.isHeadless()) return;
 
     std::ofstream best_score_file{"best_score.txt"};
     best_score_file << m_bestScore << '\n';
 }
 
+void ScoreManager::restore(const Snapshot& snapshot) noexcept {
+    saveBestScore();
+
+    m_score = snapshot.score;
+    m_scoreChange = snapshot.scoreChange;
+    m_changeApplySpeed = snapshot.changeApplySpeed;
+    m_changeApplyStart = snapshot.changeApplyStart;
+    m_scoredX = snapshot.scoredX;
+}
+
 void ScoreManager::reset() {
     saveBestScore();
 
@@ -74,32 +84,3 @@ void ScoreManager::reset() {
     m_changeApplySpeed = 0.f;
     m_scoredX = 0.f;
 }
-
-sf::Vector2f ScoreManager::drawGui(sf::Vector2f position, 
-        sf::RenderTarget& target, sf::RenderStates states) const {
-    const auto& assets = m_gameState.getAssets();
-    auto digitSize = assets.getDigitTextures()[0].getSize();
-
-    float width = Gui::drawNumber(static_cast<int>(m_score), position, target, states, assets).x;
-
-    const sf::Texture& slashTexture = assets.getSlashTexture();
-    sf::Vector2u slashSize = slashTexture.getSize();
-
-    sf::Sprite slashSprite{slashTexture};
-    slashSprite.setPosition(position.x + width, position.y);
-    target.draw(slashSprite, states);
-
-    width += slashSize.x;
-
-    width += Gui::drawNumber(static_cast<int>(m_bestScore), {position.x + width, position.y}, 
-                             target, states, assets).x;
-
-    if (m_scoreChange != 0) {
-        sf::Vector2f scoreChangePosition{position.x, position.y + digitSize.y};
-        
-        width = std::max(Gui::drawSignedNumber(static_cast<int>(m_scoreChange), 
-            scoreChangePosition, target, states, assets).x, width);
-    }
-
-    return sf::Vector2f(width, 2 * digitSize.y);
-}
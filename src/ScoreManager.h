@@ -36,12 +36,33 @@ public:
 
     void reset();
 
-    sf::Vector2f drawGui(sf::Vector2f position, 
-        sf::RenderTarget& target, sf::RenderStates states) const;
+    // best score isn't a part of snapshot
+    struct Snapshot {
+        float score;
+        float scoreChange;
+        float changeApplySpeed;
+        sf::Time changeApplyStart;
+        float scoredX;
+    };
+
+    Snapshot getSnapshot() const noexcept {
+        return {m_score, m_scoreChange, m_changeApplySpeed, m_changeApplyStart, m_scoredX};
+    }
+
+    void restore(const Snapshot& snapshot) noexcept;
+
+    float getScore() const noexcept {
+        return m_score;
+    }
 
-    float getBestScore() noexcept {
+    float getBestScore() const noexcept {
         return m_bestScore;
     }
+
+    // score added but not applied yet
+    float getScoreChange() const noexcept {
+        return m_scoreChange;
+    }
 private:
     float m_score;
     float m_bestScore;
@@ -16,25 +16,61 @@ If not, see <https://www.gnu.org/licenses/>. */
 
 #include <SFML/Audio.hpp>
 
+#include <cstdint>
+#include <cmath>
+
+// voice of SoundManager, reused for many sounds
+// used only by audio thread
 class SoundEffect {
 public:
-    SoundEffect(const sf::SoundBuffer& sound) noexcept : m_sound{sound} {
+    SoundEffect() noexcept : m_priority{0}, m_startIndex{0} {}
+
+    // stops current sound if any
+    // pan in [-1.f, 1.f], -1.f is left
+    void play(const sf::SoundBuffer& sound, float volume, float pan, 
+              int priority, uint64_t startIndex) noexcept {
+        m_sound.stop();
+        m_sound.setBuffer(sound);
+        m_sound.setVolume(volume);
+
+        // keep distance to listener 1 so panning doesn't attenuate
+        m_sound.setRelativeToListener(true);
+        m_sound.setPosition(pan, 0.f, -std::sqrt(1.f - pan * pan));
+
         m_sound.play();
+
+        m_priority = priority;
+        m_startIndex = startIndex;
     }
 
     bool hasStopped() const noexcept {
         return m_sound.getStatus() == sf::Sound::Stopped;
     }
 
-    float getVolume() const noexcept {
-        return m_sound.getVolume();
+    bool isPlaying(const sf::SoundBuffer& sound) const noexcept {
+        return m_sound.getBuffer() == &sound && !hasStopped();
     }
 
-    void setVolume(float volume) noexcept {
-        m_sound.setVolume(volume);
+    int getPriority() const noexcept {
+        return m_priority;
+    }
+
+    // sounds started earlier have smaller indices
+    uint64_t getStartIndex() const noexcept {
+        return m_startIndex;
+    }
+
+    // true if this voice should be stolen before other
+    bool isWeakerThan(const SoundEffect& other) const noexcept {
+        if (m_priority != other.m_priority)
+            return m_priority < other.m_priority;
+        return m_startIndex < other.m_startIndex;
     }
 private:
     sf::Sound m_sound;
+
+    int m_priority;
+    uint64_t m_startIndex;
 };
 
 #endif
@@ -0,0 +1,86 @@
+/* This file is part of Jutchs Shmup.
+
+Jutchs Shmup is free software: you can redistribute it and/or modify it 
+under the terms of the GNU General Public License as published by the Free Software Foundation, 
+either version 3 of the License, or (at your option) any later version.
+
+Jutchs Shmup is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with Jutchs Shmup. 
+If not, see <https://www.gnu.org/licenses/>. */
+
+#include "SoundManager.h"
+
+#include "SoundEffect.h"
+
+#include <array>
+#include <algorithm>
+#include <cstdint>
+
+namespace {
+    using Voices = std::array<SoundEffect, SoundManager::MAX_VOICES>;
+
+    // return nullptr if sound should be dropped
+    SoundEffect* findVoiceFor(Voices& voices, const sf::SoundBuffer& sound, int priority) noexcept {
+        int instances = 0;
+        SoundEffect* weakestInstance = nullptr;
+        SoundEffect* free = nullptr;
+        SoundEffect* weakest = nullptr;
+
+        for (auto& voice : voices) {
+            if (voice.hasStopped()) {
+                if (!free) free = &voice;
+                continue;
+            }
+
+            if (voice.isPlaying(sound)) {
+                ++ instances;
+                if (!weakestInstance || voice.isWeakerThan(*weakestInstance))
+                    weakestInstance = &voice;
+            }
+
+            if (!weakest || voice.isWeakerThan(*weakest))
+                weakest = &voice;
+        }
+
+        // steal only voices with the same or lower priority
+        if (instances >= SoundManager::MAX_INSTANCES)
+            return weakestInstance->getPriority() <= priority ? weakestInstance : nullptr;
+
+        if (free) return free;
+
+        return weakest->getPriority() <= priority ? weakest : nullptr;
+    }
+}
+
+SoundManager::SoundManager(bool enabled) : m_volume{1.f}, m_listenerX{0.f}, m_halfWidth{1.f} {
+    if (enabled)
+        m_audioThread = std::jthread{[this](std::stop_token stopToken) {
+            runAudio(stopToken);
+        }};
+}
+
+void SoundManager::addSoundAt(const sf::SoundBuffer& sound, float x, int priority) noexcept {
+    post(sound, std::clamp((x - m_listenerX) / m_halfWidth, -1.f, 1.f), priority);
+}
+
+void SoundManager::runAudio(std::stop_token stopToken) {
+    std::stop_callback wakeOnStop{stopToken, [this] {
+        m_commands.wakeConsumer();
+    }};
+
+    Voices voices;
+    uint64_t startedCount = 0;
+
+    while (!stopToken.stop_requested()) {
+        while (auto command = m_commands.pop()) {
+            if (SoundEffect* voice = findVoiceFor(voices, *command->sound, command->priority))
+                voice->play(*command->sound, command->volume, command->pan, 
+                            command->priority, startedCount++);
+        }
+
+        m_commands.waitForItems(stopToken);
+    }
+}
@@ -14,30 +14,41 @@ If not, see <https://www.gnu.org/licenses/>. */
 #ifndef SOUND_MANAGER_
 #define SOUND_MANAGER_
 
-#include "SoundEffect.h"
+#include "LockFreeQueue.h"
 
 #include <SFML/Audio.hpp>
 
-#include <vector>
-#include <memory>
+#include <thread>
+#include <stop_token>
 
+// all sf::Sound objects live in the audio thread
+// game thread only posts commands to it
 class SoundManager {
 public:
-    SoundManager() : m_volume{1.f} {}
+    // well below OpenAL source limit
+    static const constexpr int MAX_VOICES = 32;
+    // same sound played more times at once is indistinguishable anyway
+    static const constexpr int MAX_INSTANCES = 4;
 
-    void update() {
-        std::erase_if(m_sounds, [this](const std::unique_ptr<SoundEffect>& sound) -> bool {
-            return sound->hasStopped();
-        });
-    }
+    static const constexpr int LOW_PRIORITY  = 0;
+    static const constexpr int HIGH_PRIORITY = 1;
+
+    // disabled manager has no audio thread and drops all sounds
+    explicit SoundManager(bool enabled = true);
 
-    void addSound(std::unique_ptr<SoundEffect> sound) noexcept {
-        sound->setVolume(m_volume * sound->getVolume());
-        m_sounds.push_back(std::move(sound));
+    // sound may be dropped if all voices it can take have higher priority
+    void addSound(const sf::SoundBuffer& sound, int priority = LOW_PRIORITY) noexcept {
+        post(sound, 0.f, priority);
     }
 
-    void addSound(const sf::SoundBuffer& sound) noexcept {
-        addSound(std::make_unique<SoundEffect>(sound));
+    // panned by x relative to listener
+    void addSoundAt(const sf::SoundBuffer& sound, float x, int priority = LOW_PRIORITY) noexcept;
+
+    // sounds at listenerX are centered
+    // sounds farther than halfWidth are fully panned
+    void setListener(float listenerX, float halfWidth) noexcept {
+        m_listenerX = listenerX;
+        m_halfWidth = halfWidth;
     }
 
     float getVolume() const noexcept {
@@ -48,8 +59,30 @@ public:
         m_volume = volume;
     }
 private:
-    std::vector<std::unique_ptr<SoundEffect>> m_sounds;
+    struct Command {
+        const sf::SoundBuffer* sound; // buffers are never freed while playing
+        float volume;
+        float pan;
+        int priority;
+    };
+
+    LockFreeQueue<Command, 256> m_commands;
+
     float m_volume;
+
+    float m_listenerX;
+    float m_halfWidth;
+
+    // declared last so it's joined before everything it uses is destroyed
+    std::jthread m_audioThread;
+
+    // command is dropped if queue is full
+    void post(const sf::SoundBuffer& sound, float pan, int priority) noexcept {
+        if (!m_audioThread.joinable()) return;
+        m_commands.push(Command{&sound, m_volume * 100.f, pan, priority});
+    }
+
+    void runAudio(std::stop_token stopToken);
 };
 
-#endif
\ No newline at end of file
+#endif
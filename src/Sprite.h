@@ -20,9 +20,11 @@ If not, see <https://www.gnu.org/licenses/>. */
 #include <SFML/Graphics.hpp>
 #include <SFML/System.hpp>
 
+#include <optional>
+
 class Sprite : public virtual Entity {
 public:
-    Sprite(GameState& gameState) noexcept : m_gameState{gameState} {}
+    Sprite(GameState& gameState) noexcept : m_gameState{gameState}, m_savedPosition{} {}
 
     sf::FloatRect getGlobalBounds() const noexcept override {
         return m_sprite.getGlobalBounds();
@@ -32,6 +34,14 @@ public:
         return m_sprite.getPosition();
     }
 
+    void savePosition() noexcept override {
+        m_savedPosition = getPosition();
+    }
+
+    sf::Vector2f getStepMovement() const noexcept override {
+        return m_savedPosition ? getPosition() - *m_savedPosition : sf::Vector2f{0.f, 0.f};
+    }
+
     float getX() const noexcept {
         return getPosition().x;
     }
@@ -100,6 +110,9 @@ protected:
     }
 private:
     sf::Sprite m_sprite;
+
+    // empty until the first step after creation
+    std::optional<sf::Vector2f> m_savedPosition;
 };
 
 #endif
\ No newline at end of file
@@ -11,13 +11,34 @@ See the GNU General Public License for more details.
 You should have received a copy of the GNU General Public License along with Jutchs Shmup.
 If not, see <https://www.gnu.org/licenses/>. */
 
+
 #include "Timer.h"
 
-#include "GameState.h"
+void TimerWheel::schedule(sf::Time delay, Event event) {
+    int64_t steps = (delay.asMicroseconds() + m_step.asMicroseconds() - 1) / m_step.asMicroseconds();
+    insert({m_now + std::max<int64_t>(steps, 1), event});
+}
+
+void TimerWheel::clear() noexcept {
+    for (auto& level : m_levels)
+        for (auto& slot : level)
+            slot.clear();
+}
+
+void TimerWheel::insert(Entry entry) {
+    int64_t delay = entry.due - m_now;
+
+    int level = 0;
+    while (level + 1 < LEVEL_COUNT && delay >= levelSpan(level + 1))
+        ++ level;
+
+    m_levels[level][slotIndex(entry.due, level)].push_back(entry);
+}
 
-PassedTimer::PassedTimer(GameState& gameState) noexcept : 
-    m_gameState{gameState}, m_start{gameState.getCurrentTime()} {}
-    
-sf::Time PassedTimer::getPassedTime() const noexcept {
-    return m_gameState.getCurrentTime() - m_start;
+void TimerWheel::cascade(int level) {
+    // entries too far for the last level may return to the same slot
+    m_cascaded.clear();
+    m_cascaded.swap(m_levels[level][slotIndex(m_now, level)]);
+    for (const Entry& entry : m_cascaded)
+        insert(entry);
 }
@@ -18,6 +18,12 @@ If not, see <https://www.gnu.org/licenses/>. */
 
 #include <SFML/System.hpp>
 
+#include <vector>
+#include <array>
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+
 class OnceTimer {
 public:
     OnceTimer() noexcept : m_time{sf::Time::Zero} {}
@@ -45,66 +51,6 @@ private:
     sf::Time m_time;
 };
 
-class StepTimer {
-public:
-    StepTimer(int maxSteps = 0) : m_step{0}, m_maxSteps{maxSteps} {}
-
-    void setMaxSteps(int maxSteps) noexcept {
-        m_maxSteps = maxSteps;
-    }
-
-    void wait(sf::Time duration) noexcept {
-        m_timer.extend(duration);
-    }
-
-    void update(sf::Time duration) noexcept {
-        m_timer.update(duration);
-    }
-
-    int getStep() noexcept {
-        return m_step;
-    }
-
-    bool canStep() const noexcept {
-        return m_timer.isFinished() && m_step != m_maxSteps;
-    }
-
-    template <typename Func> 
-        requires std::convertible_to<std::invoke_result_t<Func, int>, sf::Time>
-    void forEachStep(Func&& func) {
-        while (m_timer.isFinished() && m_step < m_maxSteps) {
-            m_timer.extend(func(m_step));
-            ++ m_step;
-        }
-    }
-
-    bool isReachedMaxStep() const noexcept {
-        return m_step == m_maxSteps;
-    }
-
-    bool isFinished() const noexcept {
-        return m_timer.isFinished() && isReachedMaxStep();
-    }
-
-    void finish() noexcept {
-        m_timer.reset();
-        m_step = m_maxSteps;
-    }
-
-    void restart() noexcept {
-        m_timer.reset();
-        m_step = 0;
-    }
-
-    void tryRestart() noexcept {
-        if (isFinished()) restart();
-    }
-private:
-    OnceTimer m_timer;
-    int m_step;
-    int m_maxSteps;
-};
-
 class SwitchTimer {
 public:
     SwitchTimer(sf::Time delay) noexcept : m_delay{delay}, m_on{false} {}
@@ -133,14 +79,71 @@ private:
     bool m_on;
 };
 
-class PassedTimer {
+// timers of entities counted in simulation steps
+// hierarchical wheel: LEVEL_COUNT rings of SLOT_COUNT slots, each slot of level k covers SLOT_COUNT^k steps
+// timers move to lower levels as they come closer so advance touches only timers that fire
+// and cascaded slots, not every scheduled timer
+class TimerWheel {
 public:
-    PassedTimer(GameState& gameState) noexcept;
-    
-    sf::Time getPassedTime() const noexcept;
+    struct Event {
+        uint64_t entityId;
+        int type; // meaning depends on the entity
+    };
+
+    explicit TimerWheel(sf::Time step) noexcept : m_step{step}, m_now{0} {}
+
+    // delay is rounded up to whole steps, at least one
+    void schedule(sf::Time delay, Event event);
+
+    // go to the next step and call handler for every event due at it
+    template <std::invocable<Event> Handler>
+    void advance(Handler&& handler) {
+        ++ m_now;
+        for (int level = LEVEL_COUNT - 1; level > 0; -- level)
+            if (m_now % levelSpan(level) == 0)
+                cascade(level);
+
+        // handler may schedule new events so due ones are taken out first
+        m_due.clear();
+        m_due.swap(m_levels[0][slotIndex(m_now, 0)]);
+        for (const Entry& entry : m_due)
+            handler(entry.event);
+    }
+
+    void clear() noexcept;
 private:
-    GameState& m_gameState;
-    sf::Time m_start;
+    static const constexpr int SLOT_BITS = 6;
+    static const constexpr int SLOT_COUNT = 1 << SLOT_BITS;
+    // longer delays wait in the last level for several rounds
+    static const constexpr int LEVEL_COUNT = 3;
+
+    struct Entry {
+        int64_t due;
+        Event event;
+    };
+    using Slot = std::vector<Entry>;
+
+    sf::Time m_step;
+    int64_t m_now;
+    std::array<std::array<Slot, SLOT_COUNT>, LEVEL_COUNT> m_levels;
+
+    // reused buffers
+    Slot m_due;
+    Slot m_cascaded;
+
+    // steps covered by a single slot of level
+    static int64_t levelSpan(int level) noexcept {
+        return int64_t{1} << (SLOT_BITS * level);
+    }
+
+    static int slotIndex(int64_t step, int level) noexcept {
+        return static_cast<int>((step >> (SLOT_BITS * level)) & (SLOT_COUNT - 1));
+    }
+
+    void insert(Entry entry);
+
+    // move entries of the current slot of level to lower levels
+    void cascade(int level);
 };
 
 #endif
\ No newline at end of file
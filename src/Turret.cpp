@@ -20,7 +20,7 @@ If not, see <https://www.gnu.org/licenses/>. */
 #include <cmath>
 
 Turret::Turret(GameState& gameState, sf::Vector2f position) noexcept : 
-        m_alive{true}, m_gameState{gameState} {
+        m_alive{true}, m_loaded{true}, m_gameState{gameState} {
     const sf::Texture& baseTexture = m_gameState.getAssets().getTurretBaseTexture();
     m_base.setTexture(baseTexture);
     sf::Vector2u baseSize = baseTexture.getSize();
@@ -35,19 +35,27 @@ Turret::Turret(GameState& gameState, sf::Vector2f position) noexcept :
     m_turret.setPosition(position);
 }
 
-void Turret::update(sf::Time elapsedTime) noexcept {
-    auto& entities = m_gameState.getEntities();
+void Turret::update(sf::Time elapsedTime) {
+    UpdateCommands commands;
+    updateDeferred(elapsedTime, commands);
+    commands.apply(m_gameState);
+}
 
-    sf::Vector2f playerPosition = entities.getPlayerPosition();
-    sf::Vector2f playerDirection = normalize(playerPosition - m_turret.getPosition());
+const sf::Time TURRET_RELOAD_TIME = sf::seconds(1.0f);
 
-    m_turret.setRotation(-to_deegrees(std::atan2(playerDirection.x, playerDirection.y)));
+void Turret::updateDeferred(sf::Time, UpdateCommands& commands) {
+    // nobody sees where turrets off screen aim
+    if (m_gameState.inViewArea(getGlobalBounds())) {
+        sf::Vector2f playerDirection = getPlayerDirection();
+        m_turret.setRotation(-to_deegrees(std::atan2(playerDirection.x, playerDirection.y)));
+    }
 
-    m_shootCooldown.update(elapsedTime);
-    if (m_shootCooldown.isFinished()) {
-        entities.addEntity<TurretBullet>(m_turret.getPosition(), playerDirection);
-        m_gameState.getSounds().addSound(m_gameState.getAssets().getRandomShotSound());
-        m_shootCooldown.start(sf::seconds(1.0f));
+    if (m_loaded) {
+        commands.addEntity(m_gameState.getEntities().createEntity<TurretBullet>(
+            m_turret.getPosition(), getPlayerDirection()));
+        commands.addSoundAt(&AssetManager::getShotSounds, m_turret.getPosition().x);
+        commands.scheduleTimer(TURRET_RELOAD_TIME, {getId(), RELOAD_TIMER});
+        m_loaded = false;
     }
 }
 
@@ -16,6 +16,7 @@ If not, see <https://www.gnu.org/licenses/>. */
 
 #include "Entity.h"
 #include "GameState.h"
+#include "UpdateCommands.h"
 
 #include "Timer.h"
 #include "geometry.h"
@@ -28,7 +29,20 @@ class Turret : public CollidableBase<Turret> {
 public:
     Turret(GameState& gameState, sf::Vector2f position) noexcept;
 
-    void update(sf::Time elapsedTime) noexcept override;
+    void update(sf::Time elapsedTime) override;
+
+    bool isUpdatedInParallel() const noexcept override {
+        return true;
+    }
+
+    void updateDeferred(sf::Time elapsedTime, UpdateCommands& commands) override;
+
+    // far turrets don't aim or shoot
+    void coast(sf::Time) noexcept override {}
+
+    void handleTimer(int) noexcept override {
+        m_loaded = true;
+    }
 
     sf::FloatRect getGlobalBounds() const noexcept override {
         return m_base.getGlobalBounds();
@@ -44,15 +58,25 @@ public:
     }
 
     void handleBombExplosion(sf::Vector2f position, float radius);
+
+    std::unique_ptr<Entity> clone() const override {
+        return std::make_unique<Turret>(*this);
+    }
 private:
     sf::Sprite m_base;
     sf::Sprite m_turret;
 
     bool m_alive;
+    // set by the reload timer
+    bool m_loaded;
 
-    OnceTimer m_shootCooldown;
+    static const constexpr int RELOAD_TIMER = 0;
 
     GameState& m_gameState;
+
+    sf::Vector2f getPlayerDirection() const noexcept {
+        return normalize(m_gameState.getEntities().getPlayerPosition() - m_turret.getPosition());
+    }
 };
 
 #endif
\ No newline at end of file
@@ -19,8 +19,8 @@ If not, see <https://www.gnu.org/licenses/>. */
 
 TurretBullet::TurretBullet(GameState& gameState, 
     sf::Vector2f position, sf::Vector2f direction) noexcept :
-        Sprite{gameState}, m_speed{direction * 750.f}, 
-        m_liveTimer{gameState}, m_alive{true} {
+        Sprite{gameState}, m_speed{direction * 750.f}, m_lastMovement{0.f, 0.f}, 
+        m_age{sf::Time::Zero}, m_alive{true} {
     const sf::Texture& texture = gameState.getAssets().getBulletTexture();
     setTexture(texture);
 
@@ -37,17 +37,22 @@ bool TurretBullet::shouldBeDeleted() const noexcept {
     float gameHeight = m_gameState.getGameHeight();
     return !(m_alive 
           && (-gameHeight / 2.f <= y && y <= gameHeight / 2.f) 
-          && m_gameState.inActiveArea(x) 
-          && m_liveTimer.getPassedTime() <= sf::seconds(1.f));
+          && m_gameState.inActiveArea(x));
+}
+
+void TurretBullet::handleAdded() {
+    m_gameState.getTimers().schedule(sf::seconds(1.f), {getId(), EXPIRE_TIMER});
 }
 
 void TurretBullet::update(sf::Time elapsedTime) noexcept {
-    move(m_speed * elapsedTime.asSeconds());
-    
+    m_lastMovement = m_speed * elapsedTime.asSeconds();
+    move(m_lastMovement);
+    m_age += elapsedTime;
+
     if (isAtMaxHeight())
         setScale(1.f);
     else {
-        float t = m_liveTimer.getPassedTime().asSeconds();
+        float t = m_age.asSeconds();
         float height = VERTICAL_SPEED * t - GRAVITY * t * t / 2;
         setScale(1.f / (2.f - height));
     }
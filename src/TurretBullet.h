@@ -27,18 +27,39 @@ public:
     
     void update(sf::Time elapsedTime) noexcept override;
 
+    bool isUpdatedInParallel() const noexcept override {
+        return true;
+    }
+
+    sf::Vector2f getLastMovement() const noexcept override {
+        return m_lastMovement;
+    }
+
     bool shouldBeDeleted() const noexcept override;
 
+    void handleAdded() override;
+
+    void handleTimer(int) noexcept override {
+        m_alive = false;
+    }
+
     bool isAtMaxHeight() const noexcept {
-        return m_liveTimer.getPassedTime().asSeconds() >= VERTICAL_SPEED / GRAVITY;
+        return m_age.asSeconds() >= VERTICAL_SPEED / GRAVITY;
     }
 
     void acceptCollide(Airplane::Airplane& other) noexcept override;
+
+    std::unique_ptr<Entity> clone() const override {
+        return std::make_unique<TurretBullet>(*this);
+    }
 private:
     sf::Vector2f m_speed;
+    sf::Vector2f m_lastMovement;
 
+    sf::Time m_age;
     bool m_alive;
-    PassedTimer m_liveTimer;
+
+    static const constexpr int EXPIRE_TIMER = 0;
 
     static const constexpr float VERTICAL_SPEED = 4.472136f;
     static const constexpr float GRAVITY = 10.f;
@@ -0,0 +1,38 @@
+/* This file is part of Jutchs Shmup.
+
+Jutchs Shmup is free software: you can redistribute it and/or modify it 
+under the terms of the GNU General Public License as published by the Free Software Foundation, 
+either version 3 of the License, or (at your option) any later version.
+
+Jutchs Shmup is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with Jutchs Shmup. 
+If not, see <https://www.gnu.org/licenses/>. */
+
+#include "UpdateCommands.h"
+
+#include "GameState.h"
+
+#include "functional.h"
+#include "algorithm.h"
+
+void UpdateCommands::apply(GameState& gameState) {
+    for (auto& command : m_commands)
+        std::visit(overloaded{
+            [&gameState](std::unique_ptr<Entity>& entity) {
+                gameState.getEntities().addEntity(std::move(entity));
+            }, 
+            [&gameState](const Sound& sound) {
+                auto sounds = (gameState.getAssets().*sound.sound)();
+                gameState.getSounds().addSoundAt(random_element(sounds, gameState.getRandomEngine()), 
+                                                 sound.x, sound.priority);
+            }, 
+            [&gameState](const Timer& timer) {
+                gameState.getTimers().schedule(timer.delay, timer.event);
+            }
+        }, command);
+
+    m_commands.clear();
+}
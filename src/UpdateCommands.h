@@ -0,0 +1,72 @@
+/* This file is part of Jutchs Shmup.
+
+Jutchs Shmup is free software: you can redistribute it and/or modify it 
+under the terms of the GNU General Public License as published by the Free Software Foundation, 
+either version 3 of the License, or (at your option) any later version.
+
+Jutchs Shmup is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with Jutchs Shmup. 
+If not, see <https://www.gnu.org/licenses/>. */
+
+#ifndef UPDATE_COMMANDS_H_
+#define UPDATE_COMMANDS_H_
+
+#include "Entity.h"
+#include "AssetManager.h"
+#include "SoundManager.h"
+#include "Timer.h"
+
+#include "declarations.h"
+
+#include <SFML/Audio.hpp>
+
+#include <vector>
+#include <variant>
+#include <memory>
+#include <span>
+
+// side effects of an entity updated by a worker thread
+// applied on the game thread in the order they were posted
+class UpdateCommands {
+public:
+    // sound variants getter of AssetManager
+    using SoundChoice = std::span<const sf::SoundBuffer> (AssetManager::*)() const noexcept;
+
+    void addEntity(std::unique_ptr<Entity>&& entity) {
+        m_commands.emplace_back(std::move(entity));
+    }
+
+    // sound is chosen when applied so the random engine is used in a fixed order
+    void addSoundAt(SoundChoice sound, float x, int priority = SoundManager::LOW_PRIORITY) {
+        m_commands.emplace_back(Sound{sound, x, priority});
+    }
+
+    void scheduleTimer(sf::Time delay, TimerWheel::Event event) {
+        m_commands.emplace_back(Timer{delay, event});
+    }
+
+    bool empty() const noexcept {
+        return m_commands.empty();
+    }
+
+    // apply all commands and clear them
+    void apply(GameState& gameState);
+private:
+    struct Sound {
+        SoundChoice sound;
+        float x;
+        int priority;
+    };
+
+    struct Timer {
+        sf::Time delay;
+        TimerWheel::Event event;
+    };
+
+    std::vector<std::variant<std::unique_ptr<Entity>, Sound, Timer>> m_commands;
+};
+
+#endif
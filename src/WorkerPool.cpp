@@ -0,0 +1,61 @@
+/* This file is part of Jutchs Shmup.
+
+Jutchs Shmup is free software: you can redistribute it and/or modify it 
+under the terms of the GNU General Public License as published by the Free Software Foundation, 
+either version 3 of the License, or (at your option) any later version.
+
+Jutchs Shmup is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with Jutchs Shmup. 
+If not, see <https://www.gnu.org/licenses/>. */
+
+#include "WorkerPool.h"
+
+#include <algorithm>
+
+int WorkerPool::getDefaultThreadCount(int maxThreadCount) noexcept {
+    // hardware_concurrency may return 0 if it's unknown
+    return std::clamp(static_cast<int>(std::thread::hardware_concurrency()), 1, maxThreadCount);
+}
+
+WorkerPool::WorkerPool(int threadCount) : 
+        m_threadCount{std::max(threadCount, 1)}, m_task{nullptr}, m_stopping{false}, 
+        m_start{m_threadCount}, m_finish{m_threadCount} {
+    m_workers.reserve(m_threadCount - 1);
+    for (int thread = 1; thread < m_threadCount; ++ thread)
+        m_workers.emplace_back([this, thread] {
+            work(thread);
+        });
+}
+
+WorkerPool::~WorkerPool() {
+    if (m_workers.empty()) return;
+
+    m_stopping = true;
+    m_start.arrive_and_wait();
+}
+
+void WorkerPool::run(const std::function<void (int)>& task) {
+    if (m_workers.empty()) {
+        task(0);
+        return;
+    }
+
+    m_task = &task;
+    m_start.arrive_and_wait();
+    task(0);
+    m_finish.arrive_and_wait();
+    m_task = nullptr;
+}
+
+void WorkerPool::work(int thread) {
+    while (true) {
+        m_start.arrive_and_wait();
+        if (m_stopping) return;
+
+        (*m_task)(thread);
+        m_finish.arrive_and_wait();
+    }
+}
@@ -0,0 +1,59 @@
+/* This file is part of Jutchs Shmup.
+
+Jutchs Shmup is free software: you can redistribute it and/or modify it 
+under the terms of the GNU General Public License as published by the Free Software Foundation, 
+either version 3 of the License, or (at your option) any later version.
+
+Jutchs Shmup is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with Jutchs Shmup. 
+If not, see <https://www.gnu.org/licenses/>. */
+
+#ifndef WORKER_POOL_H_
+#define WORKER_POOL_H_
+
+#include <barrier>
+#include <thread>
+#include <vector>
+#include <functional>
+
+// threads started once and reused by every run call
+class WorkerPool {
+public:
+    // threadCount includes the thread calling run
+    explicit WorkerPool(int threadCount = 1);
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator = (const WorkerPool&) = delete;
+
+    ~WorkerPool();
+
+    int getThreadCount() const noexcept {
+        return m_threadCount;
+    }
+
+    // hardware threads but no more than maxThreadCount
+    static int getDefaultThreadCount(int maxThreadCount) noexcept;
+
+    // call task(thread) for every thread in [0, getThreadCount()) and wait for all of them
+    // task 0 runs on the calling thread
+    // waking workers costs more than a small task so callers should do small work themselves
+    void run(const std::function<void (int)>& task);
+private:
+    int m_threadCount;
+
+    const std::function<void (int)>* m_task;
+    bool m_stopping;
+
+    // written fields are visible to workers after m_start and to run after m_finish
+    std::barrier<> m_start;
+    std::barrier<> m_finish;
+
+    std::vector<std::jthread> m_workers;
+
+    void work(int thread);
+};
+
+#endif
@@ -22,6 +22,7 @@ If not, see <https://www.gnu.org/licenses/>. */
 #include <iterator>
 #include <concepts>
 #include <type_traits>
+#include <random>
 
 template <typename T>
 concept ExecutionPolicy = std::is_execution_policy_v<std::remove_cvref_t<T>>;
@@ -148,4 +149,12 @@ constexpr T max_value(Iter first, Sentinel last, T default_value = {},
         std::move(default_value), std::move(comp), std::move(proj));
 }
 
+// uniformly chosen element, range must not be empty
+template <std::ranges::random_access_range Range, std::uniform_random_bit_generator Engine>
+constexpr decltype(auto) random_element(Range&& range, Engine& engine) {
+    using Difference = std::ranges::range_difference_t<Range>;
+    std::uniform_int_distribution<Difference> distribution{0, std::ranges::ssize(range) - 1};
+    return std::ranges::begin(range)[distribution(engine)];
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,110 @@
+/* This file is part of Jutchs Shmup.
+
+Jutchs Shmup is free software: you can redistribute it and/or modify it 
+under the terms of the GNU General Public License as published by the Free Software Foundation, 
+either version 3 of the License, or (at your option) any later version.
+
+Jutchs Shmup is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with Jutchs Shmup. 
+If not, see <https://www.gnu.org/licenses/>. */
+
+#include "benchmark.h"
+
+#include "BoundsCache.h"
+#include "CollisionDetector.h"
+#include "WorkerPool.h"
+#include "HeadlessRunner.h"
+
+#include <SFML/System.hpp>
+
+#include <array>
+#include <random>
+#include <iomanip>
+
+namespace {
+    const std::array BENCHMARK_ENTITY_COUNTS{64, 256, 1024, 4096};
+    const int MAX_BENCHMARK_THREADS = 16;
+
+    // about as dense as a busy screen
+    const float BENCHMARK_AREA_SIZE = 4096.f;
+    const float BENCHMARK_BOUNDS_SIZE = 32.f;
+
+    const sf::Time MIN_BENCHMARK_TIME = sf::seconds(0.5f);
+
+    const int BENCHMARK_WORLDS = 16;
+    // ten seconds of game time
+    const int BENCHMARK_STEPS = 300;
+
+    void fillRandom(BoundsCache& bounds, int count, std::mt19937_64& randomEngine) {
+        std::uniform_real_distribution<float> positionDistribution{0.f, BENCHMARK_AREA_SIZE};
+
+        bounds.clear();
+        for (int i = 0; i < count; ++ i)
+            bounds.push({positionDistribution(randomEngine), positionDistribution(randomEngine), 
+                         BENCHMARK_BOUNDS_SIZE, BENCHMARK_BOUNDS_SIZE});
+    }
+
+    // average time of a single findPairs call
+    sf::Time timeFindPairs(CollisionDetector& detector, const BoundsCache& bounds, size_t& pairCount) {
+        sf::Clock clock;
+        int runs = 0;
+        do {
+            pairCount = detector.findPairs(bounds).size();
+            ++ runs;
+        } while (clock.getElapsedTime() < MIN_BENCHMARK_TIME);
+
+        return clock.getElapsedTime() / static_cast<sf::Int64>(runs);
+    }
+}
+
+void runCollisionBenchmark(std::ostream& out) {
+    std::mt19937_64 randomEngine;
+    BoundsCache bounds;
+    
+    int maxThreads = WorkerPool::getDefaultThreadCount(MAX_BENCHMARK_THREADS);
+    for (int count : BENCHMARK_ENTITY_COUNTS) {
+        fillRandom(bounds, count, randomEngine);
+
+        sf::Time singleThreadTime;
+        for (int threads = 1; threads <= maxThreads; threads *= 2) {
+            CollisionDetector detector{threads};
+
+            size_t pairCount;
+            sf::Time time = timeFindPairs(detector, bounds, pairCount);
+            if (threads == 1) singleThreadTime = time;
+
+            out << std::setw(5) << count << " entities " 
+                << std::setw(2) << threads << " threads (" 
+                << std::setw(2) << detector.getThreadCountFor(count) << " used): " 
+                << std::setw(8) << time.asMicroseconds() << " us, " 
+                << std::setprecision(2) << std::fixed 
+                << singleThreadTime.asSeconds() / time.asSeconds() << "x, " 
+                << pairCount << " pairs\n";
+        }
+    }
+}
+
+void runSimulationBenchmark(std::ostream& out, std::shared_ptr<const AssetManager> assets) {
+    int maxThreads = WorkerPool::getDefaultThreadCount(MAX_BENCHMARK_THREADS);
+    
+    double singleThreadRate = 0.0;
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        // the same seed every time so every run simulates the same games
+        HeadlessRunner runner{assets, BENCHMARK_WORLDS, threads};
+        runner.run(1); // load land
+
+        sf::Time time = runner.run(BENCHMARK_STEPS);
+        double rate = BENCHMARK_WORLDS * BENCHMARK_STEPS / time.asSeconds();
+        if (threads == 1) singleThreadRate = rate;
+
+        out << std::setw(2) << BENCHMARK_WORLDS << " worlds " 
+            << std::setw(2) << threads << " threads: " 
+            << std::setprecision(0) << std::fixed 
+            << std::setw(8) << rate << " ticks/s, " 
+            << std::setw(8) << rate / threads << " ticks/s per thread, " 
+            << std::setprecision(2) << rate / singleThreadRate << "x\n";
+    }
+}
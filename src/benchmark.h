@@ -0,0 +1,28 @@
+/* This file is part of Jutchs Shmup.
+
+Jutchs Shmup is free software: you can redistribute it and/or modify it 
+under the terms of the GNU General Public License as published by the Free Software Foundation, 
+either version 3 of the License, or (at your option) any later version.
+
+Jutchs Shmup is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with Jutchs Shmup. 
+If not, see <https://www.gnu.org/licenses/>. */
+
+#ifndef BENCHMARK_H_
+#define BENCHMARK_H_
+
+#include "declarations.h"
+
+#include <ostream>
+#include <memory>
+
+// time collision detection on random bounds for growing entity and thread counts
+void runCollisionBenchmark(std::ostream& out);
+
+// step the same headless games on growing thread counts
+void runSimulationBenchmark(std::ostream& out, std::shared_ptr<const AssetManager> assets);
+
+#endif
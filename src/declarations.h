@@ -17,6 +17,7 @@ If not, see <https://www.gnu.org/licenses/>. */
 /// common forward declarations
 
 class GameState;
+class AssetManager;
 
 namespace Airplane {
     class Airplane;
@@ -29,4 +30,6 @@ class AnimatedParticle;
 class Turret;
 class TurretBullet;
 
+class UpdateCommands;
+
 #endif
\ No newline at end of file
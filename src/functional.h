@@ -45,9 +45,15 @@ auto greater_than(T&& val) {
 }
 
 template <typename Component>
-const auto makeUniqueFunctor = []<typename... Args>(Args&&... args) 
+const auto constructFunctor = []<typename... Args>(Args&&... args) 
         requires std::constructible_from<Component, Args...> {
-    return std::make_unique<Component>(std::forward<Args>(args)...);
+    return Component(std::forward<Args>(args)...);
+};
+
+// visitor calling the first matching lambda
+template <typename... Funcs>
+struct overloaded : Funcs... {
+    using Funcs::operator()...;
 };
 
 #endif
\ No newline at end of file
@@ -21,6 +21,7 @@ If not, see <https://www.gnu.org/licenses/>. */
 #include <algorithm>
 #include <numbers>
 #include <cmath>
+#include <limits>
 
 // WARNING: always return false if min >= max
 template <typename T>
@@ -129,6 +130,41 @@ sf::Rect<T> extendBottom(sf::Rect<T> rect, T bottom) noexcept {
     return rect;
 }
 
+// bounds of rect on its whole way to rect moved by offset
+// WARNING: doesn't work if size < 0
+template <typename T>
+sf::Rect<T> sweep(sf::Rect<T> rect, sf::Vector2<T> offset) noexcept {
+    T newLeft = std::min(left(rect), left(rect) + offset.x);
+    T newTop  = std::min(top (rect), top (rect) + offset.y);
+    return {newLeft, newTop, rect.width + std::abs(offset.x), rect.height + std::abs(offset.y)};
+}
+
+// strict, true if moving intersects target at any moment of its movement
+// moving is the position after the movement
+// WARNING: doesn't work if size < 0
+template <typename T>
+bool sweptIntersects(sf::Rect<T> moving, sf::Vector2<T> movement, sf::Rect<T> target) noexcept {
+    // moments when moving intersects target along one axis are (enter, exit)
+    T enter = -std::numeric_limits<T>::infinity();
+    T exit  =  std::numeric_limits<T>::infinity();
+
+    auto clipAxis = [&enter, &exit](T movingMin, T movingMax, T offset, T targetMin, T targetMax) {
+        // moving starts at movingMin - offset and ends at movingMin
+        if (offset == 0)
+            return intersects(movingMin, movingMax, targetMin, targetMax);
+
+        T first  = (targetMin - (movingMax - offset)) / offset;
+        T second = (targetMax - (movingMin - offset)) / offset;
+        enter = std::max(enter, std::min(first, second));
+        exit  = std::min(exit , std::max(first, second));
+        return true;
+    };
+
+    return clipAxis(left(moving), right (moving), movement.x, left(target), right (target))
+        && clipAxis(top (moving), bottom(moving), movement.y, top (target), bottom(target))
+        && enter < exit && enter < 1 && exit > 0;
+}
+
 template <typename T>
 T dot(sf::Vector2<T> lhs, sf::Vector2<T> rhs) noexcept {
     return lhs.x * rhs.x + lhs.y * rhs.y;
@@ -12,6 +12,7 @@ You should have received a copy of the GNU General Public License along with Jut
 If not, see <https://www.gnu.org/licenses/>. */
 
 #include "GameState.h"
+#include "benchmark.h"
 
 #include <SFML/Graphics.hpp>
 #include <SFML/Window.hpp>
@@ -19,12 +20,24 @@ If not, see <https://www.gnu.org/licenses/>. */
 
 #include <iostream>
 #include <stdexcept>
+#include <string_view>
 
+#include <memory>
 #include <utility>
 using std::swap;
 
 int main(int argc, char** argv) {
     try {
+        if (argc > 1 && std::string_view{argv[1]} == "--benchmark-collisions") {
+            runCollisionBenchmark(std::cout);
+            return EXIT_SUCCESS;
+        }
+
+        if (argc > 1 && std::string_view{argv[1]} == "--benchmark-simulation") {
+            runSimulationBenchmark(std::cout, std::make_shared<const AssetManager>());
+            return EXIT_SUCCESS;
+        }
+
         auto videoMode = sf::VideoMode::getDesktopMode();
         sf::Vector2f screenSize(videoMode.width, videoMode.height);
 
@@ -39,7 +52,7 @@ int main(int argc, char** argv) {
         auto [x, y] = icon.getSize();
         window.setIcon(x, y, icon.getPixelsPtr());
 
-        GameState gameState{screenSize};
+        GameState gameState{screenSize, std::make_shared<const AssetManager>()};
 
         while (window.isOpen()) {
             sf::Event event;